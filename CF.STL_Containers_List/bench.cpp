@@ -0,0 +1,1412 @@
+//
+//  bench.cpp
+//  CF.STL_Containers_List
+//
+//  Benchmark suite for the operations demonstrated in lists.cpp, run against
+//  std::list, std::vector, std::deque and the clst containers.
+//
+//  usage: CF.STL_Containers_List_Bench [--min N] [--max N] [--filter TEXT]
+//                                      [--format table|csv|json] [--out FILE]
+//
+//  MARK: - Reference.
+//  @see: https://en.cppreference.com/w/cpp/container/list
+//  @see: https://en.cppreference.com/w/cpp/container/vector
+//  @see: https://en.cppreference.com/w/cpp/container/deque
+//
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <algorithm>
+#include <numeric>
+#include <functional>
+#include <compare>
+#include <limits>
+#include <list>
+#include <vector>
+#include <deque>
+#include <random>
+#include <streambuf>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <set>
+#include <filesystem>
+#include <utility>
+#include <cstdint>
+#include <cstdlib>
+#include <charconv>
+
+#include "stopwatch.hpp"
+#include "node_pool.hpp"
+#include "unrolled_list.hpp"
+#include "fast_sort.hpp"
+#include "parallel_sort.hpp"
+#include "list_format.hpp"
+#include "simd_compare.hpp"
+#include "concurrent_list.hpp"
+#include "indexed_list.hpp"
+#include "lru_cache.hpp"
+#include "indexed_sequence.hpp"
+#include "sorted_list.hpp"
+#include "mapped_list.hpp"
+#include "external_sort.hpp"
+#include "compact_list.hpp"
+#include "bulk_insert.hpp"
+#include "dedup.hpp"
+#include "parallel_algorithms.hpp"
+#include "list_views.hpp"
+#include "compaction.hpp"
+#include "string_arena.hpp"
+#include "tracking.hpp"
+
+using namespace std::literals::string_literals;
+using namespace std::literals::string_view_literals;
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace bench
+namespace bench {
+
+//  Optimisation barrier: keep a computed value alive without printing it.
+template<typename T>
+auto keep(T const & val) -> void {
+  asm volatile("" : : "g"(&val) : "memory");
+}
+
+auto make_values(std::size_t count, unsigned seed = 42) -> std::vector<int> {
+  std::vector<int> vals(count);
+  std::mt19937 rng { seed };
+  std::uniform_int_distribution<int> dist { 0, static_cast<int>(std::min<std::size_t>(count, 1'000'000)) };
+  std::generate(vals.begin(), vals.end(), [&]() { return dist(rng); });
+  return vals;
+}
+
+/*
+ *  MARK: options
+ */
+struct options {
+  std::size_t min_size = 10;
+  std::size_t max_size = 1'000'000;
+  std::string filter;
+  std::string format = "table"s;
+  std::string out;
+  double min_ms = 20.0;    // keep repeating small cases until this much time is spent
+  std::size_t max_reps = 10'000;
+};
+
+/*
+ *  MARK: result
+ */
+struct result {
+  std::string op;
+  std::string container;
+  std::size_t size;
+  double ms;              // mean time of one run of the operation
+  std::size_t reps;
+  std::size_t bytes = 0;  // output produced by one run, for throughput cases
+  std::size_t held = 0;   // heap bytes the container holds after one run, for footprint cases
+
+  auto ns_per_elem() const -> double { return size == 0 ? 0.0 : ms * 1e6 / static_cast<double>(size); }
+  auto mb_per_s() const -> double { return ms <= 0.0 ? 0.0 : static_cast<double>(bytes) / (ms * 1e3); }
+  auto bytes_per_elem() const -> double { return size == 0 ? 0.0 : static_cast<double>(held) / static_cast<double>(size); }
+};
+
+/*
+ *  MARK: suite
+ *  Runs cases, collects results and writes them in the requested format.
+ */
+class suite {
+public:
+  explicit suite(options opts) : opts_ { std::move(opts) } {}
+
+  auto opts() const -> options const & { return opts_; }
+
+  auto wants(std::string_view op) const -> bool {
+    return opts_.filter.empty() || op.find(opts_.filter) != std::string_view::npos;
+  }
+
+  //  Time body(state) on a fresh state = setup() - only body is timed -
+  //  repeating until min_ms has been spent.  Cases above max_size are skipped
+  //  (used to keep quadratic operations out of the big sizes).
+  template<typename Setup, typename Body>
+  auto run(std::string_view op, std::string_view container, std::size_t size,
+           Setup setup, Body body, std::size_t max_size = std::numeric_limits<std::size_t>::max()) -> void {
+    if (!wants(op) || size > max_size) {
+      return;
+    }
+    auto const [ms, reps] = measure(setup, body);
+    record(result { std::string(op), std::string(container), size, ms, reps, });
+  }
+
+  //  As run(), for cases that produce 'bytes' of output per run; reported in MB/s.
+  template<typename Setup, typename Body>
+  auto run_bytes(std::string_view op, std::string_view container, std::size_t size, std::size_t bytes,
+                 Setup setup, Body body) -> void {
+    if (!wants(op)) {
+      return;
+    }
+    auto const [ms, reps] = measure(setup, body);
+    record(result { std::string(op), std::string(container), size, ms, reps, bytes, });
+  }
+
+  //  As run(), also reporting held(state) - the heap bytes the state holds -
+  //  after one more run, per element.
+  template<typename Setup, typename Body, typename Held>
+  auto run_held(std::string_view op, std::string_view container, std::size_t size,
+                Setup setup, Body body, Held held) -> void {
+    if (!wants(op)) {
+      return;
+    }
+    auto const [ms, reps] = measure(setup, body);
+    auto state = setup();
+    body(state);
+    record(result { std::string(op), std::string(container), size, ms, reps, 0, held(state), });
+  }
+
+  //  Report a case whose results are wrong; main() then exits non-zero.
+  auto fail(std::string_view what) -> void {
+    std::cerr << what << '\n';
+    ++failures_;
+  }
+
+  auto failed() const -> bool { return failures_ != 0; }
+
+  //  Record a measurement taken by the caller.
+  auto record(result res) -> void {
+    if (opts_.format == "table"s) {
+      print_row(std::cout, res);
+    }
+    results_.push_back(std::move(res));
+  }
+
+  auto write() const -> void {
+    std::ofstream file;
+    if (!opts_.out.empty()) {
+      file.open(opts_.out);
+    }
+    std::ostream & os = opts_.out.empty() ? std::cout : file;
+    if (opts_.format == "csv"s) {
+      write_csv(os);
+    }
+    else if (opts_.format == "json"s) {
+      write_json(os);
+    }
+    else if (!opts_.out.empty()) {
+      for (auto const & res : results_) {
+        print_row(os, res);
+      }
+    }
+  }
+
+private:
+  template<typename Setup, typename Body>
+  auto measure(Setup & setup, Body & body) const -> std::pair<double, std::size_t> {
+    double total = 0.0;
+    std::size_t reps = 0;
+    do {
+      auto state = setup();
+      clst::stopwatch sw;
+      body(state);
+      total += sw.elapsed_ms();
+      keep(state);
+      ++reps;
+    } while (total < opts_.min_ms && reps < opts_.max_reps);
+    return { total / static_cast<double>(reps), reps, };
+  }
+
+  static auto print_row(std::ostream & os, result const & res) -> void {
+    auto const flags = os.flags();
+    auto const precision = os.precision();
+    os << std::left << std::setw(18) << res.op
+       << std::setw(28) << res.container
+       << std::right << std::setw(11) << res.size
+       << std::fixed << std::setprecision(4) << std::setw(14) << res.ms << " ms"
+       << std::setprecision(2) << std::setw(11) << res.ns_per_elem() << " ns/elem"
+       << std::setw(8) << res.reps << " reps"s;
+    if (res.bytes != 0) {
+      os << std::setw(10) << res.mb_per_s() << " MB/s"s;
+    }
+    if (res.held != 0) {
+      os << std::setw(10) << res.bytes_per_elem() << " B/elem"s;
+    }
+    os << '\n';
+    os.flags(flags);
+    os.precision(precision);
+  }
+
+  auto write_csv(std::ostream & os) const -> void {
+    os << "op,container,size,ms,ns_per_elem,reps,mb_per_s,bytes_per_elem\n"s;
+    for (auto const & res : results_) {
+      os << res.op << ",\""s << res.container << "\","s << res.size << ','
+         << res.ms << ',' << res.ns_per_elem() << ',' << res.reps << ',';
+      if (res.bytes != 0) {
+        os << res.mb_per_s();
+      }
+      os << ',';
+      if (res.held != 0) {
+        os << res.bytes_per_elem();
+      }
+      os << '\n';
+    }
+  }
+
+  auto write_json(std::ostream & os) const -> void {
+    os << "{\n  \"benchmark\": \"CF.STL_Containers_List_Bench\",\n"s
+       << "  \"cplusplus\": "s << __cplusplus << ",\n"s
+       << "  \"results\": [\n"s;
+    for (std::size_t ix = 0; ix < results_.size(); ++ix) {
+      auto const & res = results_[ix];
+      os << "    { \"op\": \""s << res.op << "\", \"container\": \""s << res.container
+         << "\", \"size\": "s << res.size << ", \"ms\": "s << res.ms
+         << ", \"ns_per_elem\": "s << res.ns_per_elem() << ", \"reps\": "s << res.reps;
+      if (res.bytes != 0) {
+        os << ", \"mb_per_s\": "s << res.mb_per_s();
+      }
+      if (res.held != 0) {
+        os << ", \"bytes_per_elem\": "s << res.bytes_per_elem();
+      }
+      os << (ix + 1 < results_.size() ? " },\n"s : " }\n"s);
+    }
+    os << "  ]\n}\n"s;
+  }
+
+  options opts_;
+  std::vector<result> results_;
+  std::size_t failures_ = 0;
+};
+
+//  MARK: - Cases
+//  ....+....!....+....!....+....!....+....!....+....!....+....!....+....!....+....!
+template<typename C>
+inline constexpr bool is_vector = false;
+template<typename T, typename A>
+inline constexpr bool is_vector<std::vector<T, A>> = true;
+
+template<typename C>
+inline constexpr bool is_deque = false;
+template<typename T, typename A>
+inline constexpr bool is_deque<std::deque<T, A>> = true;
+
+//  Containers with list-style member operations (remove_if, unique, sort, ...).
+template<typename C>
+inline constexpr bool is_list_like = !is_vector<C> && !is_deque<C>;
+
+/*
+ *  MARK: container_cases()
+ *  One measurement per operation the C_list() sections demonstrate.
+ */
+template<typename C>
+auto container_cases(suite & st, std::string_view name, std::vector<int> const & vals) -> void {
+  using pair_type = std::pair<C, C>;
+
+  auto const count = vals.size();
+  auto filled = [&]() { return C(vals.begin(), vals.end()); };
+  auto sorted = [&]() {
+    auto cnt = filled();
+    if constexpr (is_list_like<C>) { cnt.sort(); } else { std::sort(cnt.begin(), cnt.end()); }
+    return cnt;
+  };
+  auto two = [&]() { return pair_type { filled(), filled(), }; };
+  auto const quadratic = is_list_like<C> ? std::numeric_limits<std::size_t>::max() : std::size_t { 100'000 };
+
+  st.run("construct"sv, name, count, []() { return C(); },
+         [&](C & cnt) { cnt = C(vals.begin(), vals.end()); });
+
+  st.run("assign"sv, name, count, filled, [&](C & cnt) { cnt.assign(vals.rbegin(), vals.rend()); });
+
+  st.run("push_back"sv, name, count, []() { return C(); },
+         [&](C & cnt) { for (auto vl : vals) { cnt.push_back(vl); } });
+
+  st.run("emplace_back"sv, name, count, []() { return C(); },
+         [&](C & cnt) { for (auto vl : vals) { cnt.emplace_back(vl); } });
+
+  if constexpr (!is_vector<C>) {
+    st.run("push_front"sv, name, count, []() { return C(); },
+           [&](C & cnt) { for (auto vl : vals) { cnt.push_front(vl); } });
+  }
+
+  st.run("accumulate"sv, name, count, filled,
+         [&](C & cnt) { keep(std::accumulate(cnt.begin(), cnt.end(), 0LL)); });
+
+  st.run("erase loop"sv, name, count, filled, [&](C & cnt) {
+    for (auto it = cnt.begin(); it != cnt.end(); ) {
+      it = (*it % 2 == 0) ? cnt.erase(it) : std::next(it);
+    }
+  }, quadratic);
+
+  st.run("splice"sv, name, count, two, [&](pair_type & both) {
+    auto mid = std::next(both.first.begin(), static_cast<std::ptrdiff_t>(count / 2));
+    if constexpr (is_list_like<C>) {
+      both.first.splice(mid, both.second);
+    }
+    else {
+      both.first.insert(mid, both.second.begin(), both.second.end());
+      both.second.clear();
+    }
+  });
+
+  st.run("merge"sv, name, count, [&]() { return pair_type { sorted(), sorted(), }; }, [&](pair_type & both) {
+    if constexpr (is_list_like<C>) {
+      both.first.merge(both.second);
+    }
+    else {
+      auto const half = static_cast<std::ptrdiff_t>(both.first.size());
+      both.first.insert(both.first.end(), both.second.begin(), both.second.end());
+      std::inplace_merge(both.first.begin(), std::next(both.first.begin(), half), both.first.end());
+      both.second.clear();
+    }
+  });
+
+  st.run("remove_if"sv, name, count, filled, [&](C & cnt) {
+    if constexpr (is_list_like<C>) {
+      cnt.remove_if([](int nr) { return nr % 2 == 0; });
+    }
+    else {
+      cnt.erase(std::remove_if(cnt.begin(), cnt.end(), [](int nr) { return nr % 2 == 0; }), cnt.end());
+    }
+  });
+
+  st.run("unique"sv, name, count, sorted, [&](C & cnt) {
+    if constexpr (is_list_like<C>) {
+      cnt.unique();
+    }
+    else {
+      cnt.erase(std::unique(cnt.begin(), cnt.end()), cnt.end());
+    }
+  });
+
+  st.run("sort"sv, name, count, filled, [&](C & cnt) {
+    if constexpr (is_list_like<C>) {
+      cnt.sort();
+    }
+    else {
+      std::sort(cnt.begin(), cnt.end());
+    }
+  });
+
+  st.run("reverse"sv, name, count, filled, [&](C & cnt) {
+    if constexpr (is_list_like<C>) {
+      cnt.reverse();
+    }
+    else {
+      std::reverse(cnt.begin(), cnt.end());
+    }
+  });
+
+  st.run("operator=="sv, name, count, two, [&](pair_type & both) { keep(both.first == both.second); });
+
+  st.run("operator<=>"sv, name, count, two,
+         [&](pair_type & both) { keep(std::is_lt(both.first <=> both.second)); });
+
+  st.run("std::erase_if"sv, name, count, filled,
+         [&](C & cnt) { keep(erase_if(cnt, [](int nr) { return nr % 2 == 0; })); });
+}
+
+/*
+ *  MARK: sort_cases()
+ *  std::list::sort against clst::fast_sort and clst::parallel_sort on a list
+ *  whose nodes were shuffled in memory by an earlier sort.
+ */
+auto sort_cases(suite & st, std::vector<int> const & vals) -> void {
+  auto const count = vals.size();
+  auto cold_list = [&]() {
+    std::list<int> lst(vals.begin(), vals.end());
+    lst.sort();
+    lst.assign(vals.begin(), vals.end());
+    return lst;
+  };
+
+  st.run("cold sort asc"sv, "std::list<int>"sv, count, cold_list, [](auto & lst) { lst.sort(); });
+  st.run("cold sort asc"sv, "clst::fast_sort"sv, count, cold_list, [](auto & lst) { clst::fast_sort(lst); });
+  st.run("cold sort desc"sv, "std::list<int>"sv, count, cold_list,
+         [](auto & lst) { lst.sort(std::greater<int>()); });
+  st.run("cold sort desc"sv, "clst::fast_sort"sv, count, cold_list,
+         [](auto & lst) { clst::fast_sort(lst, std::greater<int>()); });
+
+  if (count < 100'000 || !st.wants("parallel_sort"sv)) {
+    return;
+  }
+  auto const cores = std::max(1u, std::thread::hardware_concurrency());
+  for (unsigned threads = 1; ; threads = std::min(threads * 2, cores)) {
+    clst::thread_pool pool { threads };
+    st.run("parallel_sort x"s + std::to_string(threads), "clst::parallel_sort"sv, count, cold_list,
+           [&pool](auto & lst) { clst::parallel_sort(lst, std::less<int>(), pool); });
+    if (threads == cores) {
+      break;
+    }
+  }
+}
+
+/*
+ *  MARK: compare_cases()
+ *  Element-wise == and <=> of the std containers against clst::equal and
+ *  clst::compare_three_way on two equal snapshots whose last element differs
+ *  for <=>, so every case scans the whole sequence.
+ */
+template<typename C, typename T>
+auto compare_one(suite & st, std::string_view container, std::vector<T> const & vals) -> void {
+  auto const count = vals.size();
+  auto const lhs = C(vals.begin(), vals.end());
+  auto const same = C(vals.begin(), vals.end());
+  auto tail = vals;
+  tail.back() += 1;
+  auto const more = C(tail.begin(), tail.end());
+  auto fresh = []() { return 0; };
+
+  st.run("compare =="sv, std::string(container) + " std"s, count, fresh,
+         [&](int &) { keep(lhs == same); });
+  st.run("compare <=>"sv, std::string(container) + " std"s, count, fresh,
+         [&](int &) { keep(lhs <=> more); });
+  if constexpr (clst::simd_comparable<C>) {
+    auto const isa = " clst/"s + std::string(clst::simd_isa());
+    st.run("compare =="sv, std::string(container) + isa, count, fresh,
+           [&](int &) { keep(clst::equal(lhs, same)); });
+    st.run("compare <=>"sv, std::string(container) + isa, count, fresh,
+           [&](int &) { keep(clst::compare_three_way(lhs, more)); });
+  }
+}
+
+auto compare_cases(suite & st, std::vector<int> const & vals) -> void {
+  if (!st.wants("compare"sv)) {
+    return;
+  }
+  compare_one<std::list<int>>(st, "std::list<int>"sv, vals);
+  compare_one<std::vector<int>>(st, "std::vector<int>"sv, vals);
+  compare_one<clst::unrolled_list<int>>(st, "clst::unrolled_list<int>"sv, vals);
+  std::vector<double> dbls(vals.begin(), vals.end());
+  compare_one<std::vector<double>>(st, "std::vector<double>"sv, dbls);
+  std::vector<std::int16_t> shorts(vals.begin(), vals.end());
+  compare_one<std::vector<std::int16_t>>(st, "std::vector<int16_t>"sv, shorts);
+}
+
+/*
+ *  MARK: lookup_cases()
+ *  Find by key: std::find over a std::list of pairs, the lookup the C_list
+ *  section does, against clst::indexed_list.  Each run is a batch of 'probes'
+ *  lookups of keys that are present (hit) or absent (miss).  Then a cache of
+ *  'count' entries fed keys from twice that range, so about half are hits:
+ *  a std::list LRU that finds with std::find and splices, against
+ *  clst::lru_cache.
+ */
+auto lookup_cases(suite & st, std::vector<int> const & vals) -> void {
+  auto const lookup = st.wants("lookup hit"sv) || st.wants("lookup miss"sv);
+  auto const lru = st.wants("lru get/put"sv);
+  if (!lookup && !lru) {
+    return;
+  }
+  constexpr std::size_t probes = 32;
+  constexpr std::size_t accesses = 1'000;
+  auto const count = vals.size();
+  auto const keys = static_cast<int>(count);
+
+  std::vector<int> order(count);
+  std::iota(order.begin(), order.end(), 0);
+  std::shuffle(order.begin(), order.end(), std::mt19937 { 7 });
+  std::vector<int> hits(probes);
+  std::vector<int> misses(probes);
+  for (std::size_t ix = 0; ix < probes; ++ix) {
+    hits[ix] = order[ix * count / probes];
+    misses[ix] = keys + static_cast<int>(ix);
+  }
+  auto fresh = []() { return 0; };
+
+  if (lookup) {
+    std::list<std::pair<int, int>> lst;
+    clst::indexed_list<int, int> idx;
+    idx.reserve(count);
+    for (auto key : order) {
+      lst.emplace_back(key, key);
+      idx.push_back(key, key);
+    }
+    auto const std_find = [&lst](int key) {
+      return std::find_if(lst.begin(), lst.end(), [key](auto const & el) { return el.first == key; }) != lst.end();
+    };
+    for (auto const & [op, batch] : { std::pair { "lookup hit"sv, &hits, }, std::pair { "lookup miss"sv, &misses, }, }) {
+      st.run(op, "std::list std::find"sv, count, fresh, [&, batch = batch](int &) {
+        std::size_t found = 0;
+        for (auto key : *batch) {
+          found += std_find(key) ? 1 : 0;
+        }
+        keep(found);
+      });
+      st.run(op, "clst::indexed_list"sv, count, fresh, [&, batch = batch](int &) {
+        std::size_t found = 0;
+        for (auto key : *batch) {
+          found += idx.contains(key) ? 1 : 0;
+        }
+        keep(found);
+      });
+    }
+  }
+
+  if (lru) {
+    std::vector<int> stream(accesses);
+    std::mt19937 rng { 11 };
+    std::uniform_int_distribution<int> dist { 0, 2 * keys - 1 };
+    std::generate(stream.begin(), stream.end(), [&]() { return dist(rng); });
+    //  Both caches start full, with the keys 0 .. count-1, and are reused
+    //  across runs: building one is not what is measured.
+    std::list<std::pair<int, int>> naive;
+    if (count <= 100'000) {
+      for (auto key : order) {
+        naive.emplace_back(key, key);
+      }
+    }
+    st.run("lru get/put"sv, "std::list std::find"sv, count, fresh, [&](int &) {
+      for (auto key : stream) {
+        auto it = std::find_if(naive.begin(), naive.end(), [key](auto const & el) { return el.first == key; });
+        if (it != naive.end()) {
+          naive.splice(naive.begin(), naive, it);
+        }
+        else {
+          naive.pop_back();
+          naive.emplace_front(key, key);
+        }
+      }
+    }, 100'000);
+    clst::lru_cache<int, int> cache(count);
+    for (auto key : order) {
+      cache.put(key, key);
+    }
+    st.run("lru get/put"sv, "clst::lru_cache"sv, count, fresh, [&](int &) {
+      for (auto key : stream) {
+        if (cache.get(key) == nullptr) {
+          cache.put(key, key);
+        }
+      }
+    });
+  }
+}
+
+/*
+ *  MARK: position_cases()
+ *  Reaching the element at an index - std::next on a std::list, as the erase
+ *  and splice sections do with std::advance, against clst::indexed_sequence -
+ *  then reading it, inserting and erasing there, or moving the middle half of
+ *  the sequence to another one and back.  Each run is a batch of 'probes'
+ *  operations on one container, which ends each batch as it started.
+ */
+auto position_cases(suite & st, std::vector<int> const & vals) -> void {
+  if (!(st.wants("advance"sv) || st.wants("insert/erase at"sv) || st.wants("splice range"sv))) {
+    return;
+  }
+  constexpr std::size_t probes = 32;
+  auto const count = vals.size();
+  std::vector<std::size_t> at(probes);
+  std::mt19937 rng { 5 };
+  std::uniform_int_distribution<std::size_t> dist { 0, count - 1 };
+  std::generate(at.begin(), at.end(), [&]() { return dist(rng); });
+  auto fresh = []() { return 0; };
+
+  std::list<int> lst(vals.begin(), vals.end());
+  std::list<int> lst_other;
+  clst::indexed_sequence<int> seq(vals.begin(), vals.end());
+  clst::indexed_sequence<int> seq_other;
+  auto const cap = std::size_t { 1'000'000 };  // std::next over larger lists takes seconds per batch
+
+  st.run("advance"sv, "std::list std::next"sv, count, fresh, [&](int &) {
+    long sum = 0;
+    for (auto ix : at) {
+      sum += *std::next(lst.begin(), static_cast<std::ptrdiff_t>(ix));
+    }
+    keep(sum);
+  }, cap);
+  st.run("advance"sv, "clst::indexed_sequence"sv, count, fresh, [&](int &) {
+    long sum = 0;
+    for (auto ix : at) {
+      sum += seq[ix];
+    }
+    keep(sum);
+  });
+
+  st.run("insert/erase at"sv, "std::list std::next"sv, count, fresh, [&](int &) {
+    for (auto ix : at) {
+      auto it = lst.insert(std::next(lst.begin(), static_cast<std::ptrdiff_t>(ix)), -1);
+      lst.erase(it);
+    }
+  }, cap);
+  st.run("insert/erase at"sv, "clst::indexed_sequence"sv, count, fresh, [&](int &) {
+    for (auto ix : at) {
+      auto it = seq.insert(seq.nth(ix), -1);
+      seq.erase(it);
+    }
+  });
+
+  auto const first = static_cast<std::ptrdiff_t>(count / 4);
+  auto const last = static_cast<std::ptrdiff_t>(count - count / 4);
+  st.run("splice range"sv, "std::list std::next"sv, count, fresh, [&](int &) {
+    lst_other.splice(lst_other.end(), lst, std::next(lst.begin(), first), std::next(lst.begin(), last));
+    lst.splice(std::next(lst.begin(), first), lst_other);
+  }, cap);
+  st.run("splice range"sv, "clst::indexed_sequence"sv, count, fresh, [&](int &) {
+    seq_other.splice(seq_other.end(), seq, seq.nth(static_cast<std::size_t>(first)), seq.nth(static_cast<std::size_t>(last)));
+    seq.splice(seq.nth(static_cast<std::size_t>(first)), seq_other);
+  });
+}
+
+/*
+ *  MARK: sorted_cases()
+ *  A mixed workload on a sorted sequence of 'count' elements: a batch of
+ *  inserts, then as many lookups, then the inserted elements are erased again
+ *  so every run starts from the same sequence.  std::list either appends and
+ *  sorts after the batch, or scans for each insert position; both find by
+ *  scanning.  clst::sorted_list does all three in O(log n).
+ */
+auto sorted_cases(suite & st, std::vector<int> const & vals) -> void {
+  if (!st.wants("sorted mixed"sv)) {
+    return;
+  }
+  constexpr std::size_t batch = 32;
+  auto const count = vals.size();
+  std::vector<int> fresh_vals(batch);
+  std::vector<int> probes(batch);
+  std::mt19937 rng { 13 };
+  std::uniform_int_distribution<int> dist { 0, static_cast<int>(std::min<std::size_t>(count, 1'000'000)) };
+  std::generate(fresh_vals.begin(), fresh_vals.end(), [&]() { return dist(rng); });
+  std::generate(probes.begin(), probes.end(), [&]() { return dist(rng); });
+  auto fresh = []() { return 0; };
+
+  auto sorted_vals = vals;
+  std::sort(sorted_vals.begin(), sorted_vals.end());
+  std::list<int> lst(sorted_vals.begin(), sorted_vals.end());
+  clst::sorted_list<int> sl(sorted_vals.begin(), sorted_vals.end());
+  std::vector<std::list<int>::iterator> added(batch);
+  std::vector<clst::sorted_list<int>::iterator> sl_added(batch);
+
+  st.run("sorted mixed"sv, "std::list sort after insert"sv, count, fresh, [&](int &) {
+    for (std::size_t ix = 0; ix < batch; ++ix) {
+      added[ix] = lst.insert(lst.end(), fresh_vals[ix]);
+    }
+    lst.sort();
+    std::size_t found = 0;
+    for (auto key : probes) {
+      found += std::find(lst.begin(), lst.end(), key) != lst.end() ? 1 : 0;
+    }
+    keep(found);
+    for (auto it : added) {
+      lst.erase(it);
+    }
+  });
+  st.run("sorted mixed"sv, "std::list scan to insert"sv, count, fresh, [&](int &) {
+    for (std::size_t ix = 0; ix < batch; ++ix) {
+      auto const key = fresh_vals[ix];
+      added[ix] = lst.insert(std::find_if(lst.begin(), lst.end(), [key](int el) { return key < el; }), key);
+    }
+    std::size_t found = 0;
+    for (auto key : probes) {
+      found += std::find(lst.begin(), lst.end(), key) != lst.end() ? 1 : 0;
+    }
+    keep(found);
+    for (auto it : added) {
+      lst.erase(it);
+    }
+  });
+  st.run("sorted mixed"sv, "clst::sorted_list"sv, count, fresh, [&](int &) {
+    for (std::size_t ix = 0; ix < batch; ++ix) {
+      sl_added[ix] = sl.insert(fresh_vals[ix]);
+    }
+    std::size_t found = 0;
+    for (auto key : probes) {
+      found += sl.contains(key) ? 1 : 0;
+    }
+    keep(found);
+    for (auto it : sl_added) {
+      sl.erase(it);
+    }
+  });
+}
+
+/*
+ *  MARK: restart_cases()
+ *  What a restarted process pays to get its list back: rebuilding a
+ *  std::list<int> from a text dump, against mapping a clst::mapped_list file,
+ *  alone and followed by a walk over every element.  Both files are written
+ *  once beforehand and are in the page cache when timed.
+ */
+auto restart_cases(suite & st, std::vector<int> const & vals) -> void {
+  if (!st.wants("restart"sv)) {
+    return;
+  }
+  auto const count = vals.size();
+  auto const dir = std::filesystem::temp_directory_path();
+  auto const text = dir / "CF.STL_Containers_List_Bench.txt"s;
+  auto const mapped = dir / "CF.STL_Containers_List_Bench.mapped"s;
+  {
+    std::ofstream dump { text };
+    for (auto nr : vals) {
+      dump << nr << '\n';
+    }
+    std::filesystem::remove(mapped);
+    clst::mapped_list<int> lst(mapped, count, false);
+    for (auto nr : vals) {
+      lst.push_back(nr);
+    }
+    lst.sync();
+  }
+  auto fresh = []() { return 0; };
+
+  st.run("restart"sv, "std::list<int> parse text"sv, count, fresh, [&](int &) {
+    std::ifstream dump { text };
+    std::list<int> lst;
+    for (int nr = 0; dump >> nr; ) {
+      lst.push_back(nr);
+    }
+    keep(std::accumulate(lst.begin(), lst.end(), 0L));
+  });
+  st.run("restart"sv, "clst::mapped_list open"sv, count, fresh, [&](int &) {
+    clst::mapped_list<int> lst(mapped, count, false);
+    keep(lst.front());
+  });
+  st.run("restart"sv, "clst::mapped_list open+walk"sv, count, fresh, [&](int &) {
+    clst::mapped_list<int> lst(mapped, count, false);
+    keep(std::accumulate(lst.begin(), lst.end(), 0L));
+  });
+
+  std::filesystem::remove(text);
+  std::filesystem::remove(mapped);
+}
+
+/*
+ *  MARK: external_cases()
+ *  Sorting 'count' elements with ten times fewer bytes of memory than they
+ *  take up, through clst::external_sorter, against a std::list sorted in
+ *  memory.  The runs go to the temporary directory and are read back while
+ *  they are still in the page cache, so this measures the sorter's own cost.
+ */
+auto external_cases(suite & st, std::vector<int> const & vals) -> void {
+  if (!st.wants("external sort"sv)) {
+    return;
+  }
+  auto const count = vals.size();
+  clst::external_sort_options opts;
+  opts.memory_bytes = std::max<std::size_t>(count * sizeof(int) / 10, 1);
+  auto fresh = []() { return 0; };
+
+  st.run("external sort"sv, "std::list<int> in memory"sv, count, fresh, [&](int &) {
+    std::list<int> lst(vals.begin(), vals.end());
+    lst.sort();
+    keep(std::accumulate(lst.begin(), lst.end(), 0L));
+  });
+  st.run("external sort"sv, "clst::external_sorter"sv, count, fresh, [&](int &) {
+    clst::external_sorter<int> sorter { opts };
+    sorter.push(vals.begin(), vals.end());
+    long sum = 0;
+    sorter.finish([&sum](int el) { sum += el; });
+    keep(sum);
+  });
+}
+
+/*
+ *  MARK: footprint_cases()
+ *  Filling a list with push_back, reported with the heap bytes it then holds
+ *  per element.  The std::list bytes are what its nodes ask of the allocator,
+ *  counted by clst::tracking_allocator; malloc's own header and rounding come
+ *  on top.  clst::compact_list reports both vectors at their capacity.
+ */
+template<typename T>
+auto footprint_one(suite & st, std::string_view type, std::vector<int> const & vals) -> void {
+  using tracked_list = std::list<T, clst::tracking_allocator<T>>;
+
+  auto const count = vals.size();
+  auto fill = [&vals](auto & lst) {
+    for (auto vl : vals) {
+      lst.push_back(static_cast<T>(vl));
+    }
+  };
+
+  st.run_held("footprint"sv, "std::list<"s + std::string(type) + ">"s, count,
+              []() { return std::list<T>(); }, fill, [&fill](auto &) {
+    clst::tracking_scope scope { "bench footprint"sv };
+    tracked_list lst;
+    fill(lst);
+    return static_cast<std::size_t>(clst::tracking::current().live_bytes);
+  });
+  st.run_held("footprint"sv, "clst::compact_list<"s + std::string(type) + ">"s, count,
+              []() { return clst::compact_list<T>(); }, fill, [](auto & lst) { return lst.memory_bytes(); });
+}
+
+auto footprint_cases(suite & st, std::vector<int> const & vals) -> void {
+  if (!st.wants("footprint"sv)) {
+    return;
+  }
+  footprint_one<int>(st, "int"sv, vals);
+  footprint_one<char>(st, "char"sv, vals);
+}
+
+/*
+ *  MARK: bulk_cases()
+ *  Loading a batch of 'count' elements into a list whose allocator has been
+ *  through churn - as many nodes allocated and freed in random order - so
+ *  node-at-a-time allocation picks up blocks scattered across the heap, then
+ *  walking the loaded list.  clst::append_range takes the batch's nodes as
+ *  one run of adjacent blocks, in traversal order.
+ */
+auto bulk_cases(suite & st, std::vector<int> const & vals) -> void {
+  if (!st.wants("bulk load"sv) && !st.wants("bulk traverse"sv)) {
+    return;
+  }
+  auto const count = vals.size();
+  std::vector<std::size_t> order(count);
+  std::iota(order.begin(), order.end(), std::size_t { 0 });
+  std::shuffle(order.begin(), order.end(), std::mt19937 { 17 });
+
+  auto churn = [&](auto & lst) {
+    lst.assign(vals.begin(), vals.end());
+    std::vector<typename std::remove_reference_t<decltype(lst)>::iterator> nodes;
+    nodes.reserve(count);
+    for (auto it = lst.begin(); it != lst.end(); ++it) {
+      nodes.push_back(it);
+    }
+    for (auto ix : order) {
+      lst.erase(nodes[ix]);
+    }
+  };
+
+  struct pooled {
+    std::unique_ptr<clst::node_pool<int>> pool;
+    clst::pooled_list<int> lst;
+  };
+  auto std_churned = [&]() {
+    std::list<int> lst;
+    churn(lst);
+    return lst;
+  };
+  auto pool_churned = [&]() {
+    auto pool = std::make_unique<clst::node_pool<int>>();
+    clst::pooled_list<int> lst { clst::pool_allocator<int>(*pool) };
+    churn(lst);
+    return pooled { std::move(pool), std::move(lst), };
+  };
+  auto std_load = [&](std::list<int> & lst) { lst.insert(lst.end(), vals.begin(), vals.end()); };
+  auto pool_load = [&](pooled & pl) { pl.lst.insert(pl.lst.end(), vals.begin(), vals.end()); };
+  auto bulk_load = [&](pooled & pl) { clst::append_range(pl.lst, vals); };
+
+  st.run("bulk load"sv, "std::list<int> insert"sv, count, std_churned, std_load);
+  st.run("bulk load"sv, "clst::pooled_list insert"sv, count, pool_churned, pool_load);
+  st.run("bulk load"sv, "clst::append_range"sv, count, pool_churned, bulk_load);
+
+  auto walk = [](auto & lst) { keep(std::accumulate(lst.begin(), lst.end(), 0L)); };
+  st.run("bulk traverse"sv, "std::list<int> insert"sv, count,
+         [&]() { auto lst = std_churned(); std_load(lst); return lst; }, walk);
+  st.run("bulk traverse"sv, "clst::pooled_list insert"sv, count,
+         [&]() { auto pl = pool_churned(); pool_load(pl); return pl; }, [&](pooled & pl) { walk(pl.lst); });
+  st.run("bulk traverse"sv, "clst::append_range"sv, count,
+         [&]() { auto pl = pool_churned(); bulk_load(pl); return pl; }, [&](pooled & pl) { walk(pl.lst); });
+}
+
+/*
+ *  MARK: dedup_cases()
+ *  Removing every repeated value from a list of 'count' values drawn from
+ *  [0, min(count, 1e6)]: std::list sort + unique, which also loses the order,
+ *  against clst::dedup, which keeps the first of each in place.
+ */
+auto dedup_cases(suite & st, std::vector<int> const & vals) -> void {
+  auto const count = vals.size();
+  auto filled = [&]() { return std::list<int>(vals.begin(), vals.end()); };
+
+  st.run("dedup"sv, "std::list sort+unique"sv, count, filled, [](std::list<int> & lst) {
+    lst.sort();
+    keep(lst.unique());
+  });
+  st.run("dedup"sv, "clst::dedup"sv, count, filled, [](std::list<int> & lst) { keep(clst::dedup(lst)); });
+  st.run("dedup"sv, "clst::dedup compact_list"sv, count, [&]() { return clst::compact_list<int>(vals.begin(), vals.end()); },
+         [](clst::compact_list<int> & lst) { keep(clst::dedup(lst)); });
+}
+
+/*
+ *  MARK: par_cases()
+ *  Summing and filtering a std::list<int> of 'count' values on 1, 2, 4 ...
+ *  threads up to the core count, against the serial algorithms.  "harvest"
+ *  finds the segment cuts on every call; "cached" finds them once per pool,
+ *  which is what a caller running several passes over a list would do.
+ */
+auto par_cases(suite & st, std::vector<int> const & vals) -> void {
+  auto const count = vals.size();
+  if (count < 100'000 || !(st.wants("par reduce"sv) || st.wants("par remove_if"sv))) {
+    return;
+  }
+  std::list<int> lst(vals.begin(), vals.end());
+  auto fresh = []() { return 0; };
+  auto filled = [&]() { return std::list<int>(vals.begin(), vals.end()); };
+  auto odd = [](int val) { return (val & 1) != 0; };
+
+  st.run("par reduce"sv, "std::accumulate"sv, count, fresh, [&](int &) {
+    keep(std::accumulate(lst.begin(), lst.end(), 0L));
+  });
+  st.run("par remove_if"sv, "std::list::remove_if"sv, count, filled, [&](std::list<int> & ls) {
+    keep(ls.remove_if(odd));
+  });
+
+  auto const cores = std::max(1u, std::thread::hardware_concurrency());
+  for (unsigned threads = 1; ; threads = std::min(threads * 2, cores)) {
+    clst::thread_pool pool { threads };
+    auto const op = "par reduce x"s + std::to_string(threads);
+    st.run(op, "clst::par harvest"sv, count, fresh, [&](int &) {
+      keep(clst::par::transform_reduce(pool, lst, 0L, std::plus<>(), [](int val) { return long { val }; }));
+    });
+    auto const segs = clst::par::make_segments(pool, lst);
+    st.run(op, "clst::par cached"sv, count, fresh, [&](int &) {
+      keep(clst::par::transform_reduce(pool, segs, 0L, std::plus<>(), [](int val) { return long { val }; }));
+    });
+    st.run("par remove_if x"s + std::to_string(threads), "clst::par::remove_if"sv, count, filled,
+           [&](std::list<int> & ls) { keep(clst::par::remove_if(pool, ls, odd)); });
+    if (threads == cores) {
+      break;
+    }
+  }
+}
+
+/*
+ *  MARK: pipeline_cases()
+ *  A three-stage pipeline - keep the even values, halve them, drop adjacent
+ *  repeats - over a sorted std::list<int> of 'count' values: copying the
+ *  list and running remove_if, for_each and unique on the copy, against one
+ *  fused clst::views pass into a new std::list or a pooled list.
+ */
+auto pipeline_cases(suite & st, std::vector<int> const & vals) -> void {
+  if (!st.wants("pipeline"sv)) {
+    return;
+  }
+  auto const count = vals.size();
+  std::list<int> source(vals.begin(), vals.end());
+  source.sort();
+  auto fresh = []() { return 0; };
+  auto odd = [](int val) { return (val & 1) != 0; };
+  auto even = [](int val) { return (val & 1) == 0; };
+  auto half = [](int val) { return val / 2; };
+
+  st.run("pipeline"sv, "std::list copy+mutate"sv, count, fresh, [&](int &) {
+    std::list<int> out(source);
+    out.remove_if(odd);
+    std::for_each(out.begin(), out.end(), [&half](int & val) { val = half(val); });
+    out.unique();
+    keep(out);
+  });
+  st.run("pipeline"sv, "clst::views"sv, count, fresh, [&](int &) {
+    keep(source | clst::views::filter(even) | clst::views::transform(half) | clst::views::dedup_adjacent
+                | clst::to<std::list<int>>());
+  });
+  clst::node_pool<int> pool;
+  st.run("pipeline"sv, "clst::views pooled"sv, count, fresh, [&](int &) {
+    keep(source | clst::views::filter(even) | clst::views::transform(half) | clst::views::dedup_adjacent
+                | clst::to<clst::pooled_list<int>>(clst::pool_allocator<int>(pool)));
+  });
+}
+
+/*
+ *  MARK: compact_cases()
+ *  Summing a clst::pooled_list<int> of 'count' values with std::accumulate
+ *  after the list has been sorted by value, which leaves list order unrelated
+ *  to memory order, and again after clst::compact has put the nodes back in
+ *  order; plain and through clst::prefetched.  Also the cost of compacting.
+ */
+auto compact_cases(suite & st, std::vector<int> const & vals) -> void {
+  if (!st.wants("accumulate"sv) && !st.wants("compact"sv)) {
+    return;
+  }
+  auto const count = vals.size();
+  struct pooled {
+    std::unique_ptr<clst::node_pool<int>> pool;
+    clst::pooled_list<int> lst;
+  };
+  auto scattered = [&]() {
+    auto pool = std::make_unique<clst::node_pool<int>>();
+    clst::pooled_list<int> lst { clst::pool_allocator<int>(*pool) };
+    clst::append_range(lst, vals);
+    lst.sort();
+    return pooled { std::move(pool), std::move(lst), };
+  };
+
+  st.run("compact"sv, "clst::compact"sv, count, scattered, [](pooled & pl) { clst::compact(pl.lst); });
+
+  if (!st.wants("accumulate"sv)) {
+    return;
+  }
+  auto pl = scattered();
+  auto fresh = []() { return 0; };
+  auto sum = [&](int &) { keep(std::accumulate(pl.lst.begin(), pl.lst.end(), 0L)); };
+  auto sum_prefetched = [&](int &) {
+    auto rg = clst::prefetched(pl.lst);
+    keep(std::accumulate(rg.begin(), rg.end(), 0L));
+  };
+  st.run("accumulate"sv, "pooled scattered"sv, count, fresh, sum);
+  st.run("accumulate"sv, "pooled scattered prefetch"sv, count, fresh, sum_prefetched);
+  clst::compact(pl.lst);
+  st.run("accumulate"sv, "pooled compacted"sv, count, fresh, sum);
+  st.run("accumulate"sv, "pooled compacted prefetch"sv, count, fresh, sum_prefetched);
+}
+
+/*
+ *  MARK: string_cases()
+ *  Lists of 'count' short strings drawn from 1000 distinct values, as keys
+ *  repeat in production data, each too long for std::string's small buffer:
+ *  std::list<std::string> against clst::istring_list over a string_arena.
+ *  "str footprint" reports the heap bytes per element - nodes and string
+ *  buffers, or nodes and the arena's share; "str equal" compares two equal
+ *  lists element by element; "str sort" sorts a list.
+ */
+auto string_cases(suite & st, std::vector<int> const & vals) -> void {
+  if (!st.wants("str footprint"sv) && !st.wants("str equal"sv) && !st.wants("str sort"sv)) {
+    return;
+  }
+  using tstring = std::basic_string<char, std::char_traits<char>, clst::tracking_allocator<char>>;
+  auto const count = vals.size();
+  auto text = [](int val) { return "customer-region-"s + std::to_string(val % 1'000); };
+
+  auto strings = [&]() {
+    std::list<std::string> lst;
+    for (auto vl : vals) {
+      lst.push_back(text(vl));
+    }
+    return lst;
+  };
+  clst::string_arena arena;
+  auto interned = [&]() {
+    clst::istring_list<> lst;
+    for (auto vl : vals) {
+      lst.push_back(arena.intern(text(vl)));
+    }
+    return lst;
+  };
+
+  st.run_held("str footprint"sv, "std::list<std::string>"sv, count, []() { return 0; }, [](int &) {}, [&](int &) {
+    clst::tracking_scope scope { "bench str footprint"sv };
+    std::list<tstring, clst::tracking_allocator<tstring>> lst;
+    for (auto vl : vals) {
+      auto const str = text(vl);
+      lst.emplace_back(str.begin(), str.end());
+    }
+    return static_cast<std::size_t>(clst::tracking::current().live_bytes);
+  });
+  st.run_held("str footprint"sv, "clst::istring_list"sv, count, []() { return 0; }, [](int &) {}, [&](int &) {
+    clst::tracking_scope scope { "bench str footprint"sv };
+    clst::string_arena own;
+    std::list<clst::istring, clst::tracking_allocator<clst::istring>> lst;
+    for (auto vl : vals) {
+      lst.push_back(own.intern(text(vl)));
+    }
+    return static_cast<std::size_t>(clst::tracking::current().live_bytes) + own.memory_bytes();
+  });
+
+  auto const str_a = strings();
+  auto const str_b = strings();
+  auto const is_a = interned();
+  auto const is_b = interned();
+  auto fresh = []() { return 0; };
+  st.run("str equal"sv, "std::list<std::string>"sv, count, fresh, [&](int &) { keep(str_a == str_b); });
+  st.run("str equal"sv, "clst::istring_list"sv, count, fresh, [&](int &) { keep(is_a == is_b); });
+
+  st.run("str sort"sv, "std::list<std::string>"sv, count, strings, [](auto & lst) { lst.sort(); });
+  st.run("str sort"sv, "clst::istring_list"sv, count, interned, [](auto & lst) { lst.sort(); });
+}
+
+/*
+ *  MARK: concurrent_cases()
+ *  The demo's find / insert-before / remove from 1 to 64 threads at once:
+ *  clst::concurrent_list against one std::mutex around a std::list.  Each run
+ *  performs 'ops' operations in total, 80% finds, 10% inserts, 10% removes, on
+ *  keys drawn from twice the list's initial size.  The threads are started
+ *  during setup and released by the timed body, so thread creation is not
+ *  part of the measurement.
+ */
+class locked_list {
+public:
+  explicit locked_list(std::vector<int> const & vals) : lst_(vals.begin(), vals.end()) {}
+
+  auto push_front(int value) -> void {
+    std::lock_guard<std::mutex> lock { mtx_ };
+    lst_.push_front(value);
+  }
+  auto find(int value) -> bool {
+    std::lock_guard<std::mutex> lock { mtx_ };
+    return std::find(lst_.begin(), lst_.end(), value) != lst_.end();
+  }
+  auto insert_before(int pos_value, int value) -> bool {
+    std::lock_guard<std::mutex> lock { mtx_ };
+    auto it = std::find(lst_.begin(), lst_.end(), pos_value);
+    if (it == lst_.end()) {
+      return false;
+    }
+    lst_.insert(it, value);
+    return true;
+  }
+  auto remove(int value) -> std::size_t {
+    std::lock_guard<std::mutex> lock { mtx_ };
+    return lst_.remove(value);
+  }
+
+private:
+  std::mutex mtx_;
+  std::list<int> lst_;
+};
+
+//  Starts 'threads' workers on 'lst' that wait until go() releases them.
+template<typename List>
+class mixed_workload {
+public:
+  mixed_workload(std::unique_ptr<List> lst, unsigned threads, std::size_t ops, int keys) : lst_ { std::move(lst) } {
+    for (unsigned th = 0; th < threads; ++th) {
+      pool_.emplace_back([this, th, threads, ops, keys]() {
+        start_.wait(false);
+        std::mt19937 rng { th + 1 };
+        std::uniform_int_distribution<int> key { 0, keys - 1 };
+        for (std::size_t op = th; op < ops; op += threads) {
+          auto const roll = rng() % 10;
+          if (roll == 0) {
+            lst_->insert_before(key(rng), key(rng));
+          }
+          else if (roll == 1) {
+            lst_->remove(key(rng));
+          }
+          else {
+            keep(lst_->find(key(rng)));
+          }
+        }
+      });
+    }
+  }
+
+  mixed_workload(mixed_workload const &) = delete;
+  auto operator=(mixed_workload const &) -> mixed_workload & = delete;
+
+  ~mixed_workload() { go(); }
+
+  //  Release the workers and wait for all of them to finish.
+  auto go() -> void {
+    start_.store(true);
+    start_.notify_all();
+    for (auto & th : pool_) {
+      if (th.joinable()) {
+        th.join();
+      }
+    }
+  }
+
+private:
+  std::unique_ptr<List> lst_;
+  std::atomic<bool> start_ { false };
+  std::vector<std::thread> pool_;
+};
+
+//  Every thread inserts its own keys, removes half of them again and searches
+//  for everyone else's; afterwards exactly the other half must be present.
+auto stress(unsigned threads, int per_thread) -> bool {
+  clst::concurrent_list<int> lst;
+  std::vector<std::thread> pool;
+  for (unsigned th = 0; th < threads; ++th) {
+    pool.emplace_back([&lst, th, per_thread]() {
+      auto const base = static_cast<int>(th) * per_thread;
+      for (int ix = 0; ix < per_thread; ++ix) {
+        if (ix % 2 == 0 || !lst.insert_before(base + ix - 1, base + ix)) {
+          lst.push_front(base + ix);
+        }
+        keep(lst.find(ix));
+      }
+      lst.remove_if([base, per_thread](int nr) { return nr >= base && nr < base + per_thread && nr % 2 == 1; });
+    });
+  }
+  for (auto & th : pool) {
+    th.join();
+  }
+  std::set<int> seen;
+  std::size_t visited = 0;
+  lst.for_each([&](int nr) { seen.insert(nr); ++visited; });
+  auto ok = visited == seen.size() && lst.size() == visited;
+  for (int nr = 0; nr < static_cast<int>(threads) * per_thread; ++nr) {
+    ok = ok && (seen.count(nr) == 1) == (nr % 2 == 0);
+  }
+  return ok;
+}
+
+auto concurrent_cases(suite & st, std::vector<int> const & vals) -> void {
+  auto const count = vals.size();
+  if (!(st.wants("concurrent stress"sv) || st.wants("concurrent x"sv)) || count > 10'000) {
+    return;
+  }
+  auto const keys = static_cast<int>(2 * count);
+  std::size_t const ops = 10'000;
+
+  auto const per_thread = static_cast<int>(std::min<std::size_t>(count, 1'000));
+  st.run("concurrent stress"sv, "clst::concurrent_list x8"sv, 8 * per_thread, []() { return 0; }, [&st, per_thread](int &) {
+    if (!stress(8, per_thread)) {
+      st.fail("concurrent stress: clst::concurrent_list lost or kept the wrong elements"sv);
+    }
+  });
+
+  for (unsigned threads = 1; threads <= 64; threads *= 2) {
+    auto const op = "concurrent x"s + std::to_string(threads);
+    st.run(op, "std::mutex + std::list"sv, ops,
+           [&]() {
+             return std::make_unique<mixed_workload<locked_list>>(std::make_unique<locked_list>(vals), threads, ops, keys);
+           },
+           [](auto & work) { work->go(); });
+    st.run(op, "clst::concurrent_list"sv, ops,
+           [&]() {
+             auto lst = std::make_unique<clst::concurrent_list<int>>();
+             std::for_each(vals.rbegin(), vals.rend(), [&](int nr) { lst->push_front(nr); });
+             return std::make_unique<mixed_workload<clst::concurrent_list<int>>>(std::move(lst), threads, ops, keys);
+           },
+           [](auto & work) { work->go(); });
+  }
+}
+
+/*
+ *  MARK: null_sink
+ *  Stream buffer that discards output and counts it, so formatting cases
+ *  measure the formatter and not the terminal.
+ */
+class null_sink : public std::streambuf {
+public:
+  auto count() const -> std::size_t { return count_; }
+
+protected:
+  auto overflow(int_type ch) -> int_type override {
+    ++count_;
+    return traits_type::not_eof(ch);
+  }
+
+  auto xsputn(char const *, std::streamsize n) -> std::streamsize override {
+    count_ += static_cast<std::size_t>(n);
+    return n;
+  }
+
+private:
+  std::size_t count_ = 0;
+};
+
+/*
+ *  MARK: format_cases()
+ *  operator<< element by element (clst::print_list) against the buffered
+ *  clst::list_writer, for int, double and std::string elements.
+ */
+template<typename T>
+auto format_one(suite & st, std::string_view container, std::list<T> const & lst) -> void {
+  null_sink probe;
+  std::ostream pos { &probe };
+  clst::print_list(pos, lst);
+  auto const bytes = probe.count();
+  auto const count = lst.size();
+  auto fresh = []() { return 0; };
+
+  st.run_bytes("format"sv, std::string(container) + " ostream"s, count, bytes, fresh, [&](int &) {
+    null_sink sink;
+    std::ostream os { &sink };
+    clst::print_list(os, lst);
+    keep(sink.count());
+  });
+  st.run_bytes("format"sv, std::string(container) + " list_writer"s, count, bytes, fresh, [&](int &) {
+    null_sink sink;
+    std::ostream os { &sink };
+    os << clst::fast(lst);
+    keep(sink.count());
+  });
+}
+
+auto format_cases(suite & st, std::vector<int> const & vals) -> void {
+  if (!st.wants("format"sv)) {
+    return;
+  }
+  format_one(st, "std::list<int>"sv, std::list<int>(vals.begin(), vals.end()));
+  std::list<double> dbls;
+  std::transform(vals.begin(), vals.end(), std::back_inserter(dbls), [](int nr) { return nr / 7.0; });
+  format_one(st, "std::list<double>"sv, dbls);
+  std::list<std::string> strs;
+  std::transform(vals.begin(), vals.end(), std::back_inserter(strs), [](int nr) { return std::to_string(nr); });
+  format_one(st, "std::list<std::string>"sv, strs);
+}
+
+auto parse(int argc, const char * argv[]) -> options {
+  options opts;
+  auto usage = [&]() {
+    std::cerr << "usage: "s << argv[0]
+              << " [--min N] [--max N] [--filter TEXT] [--format table|csv|json] [--out FILE]\n"s;
+    std::exit(2);
+  };
+  for (int ix = 1; ix < argc; ++ix) {
+    std::string_view arg { argv[ix] };
+    auto value = [&]() -> std::string {
+      if (ix + 1 >= argc) {
+        std::cerr << "missing value for "s << arg << '\n';
+        std::exit(2);
+      }
+      return argv[++ix];
+    };
+    //  A whole, non-negative integer that fits in std::size_t.
+    auto size = [&]() -> std::size_t {
+      auto const text = value();
+      std::size_t num = 0;
+      auto const [end, ec] = std::from_chars(text.data(), text.data() + text.size(), num);
+      if (ec != std::errc {} || end != text.data() + text.size()) {
+        std::cerr << "bad value "s << text << " for "s << arg << '\n';
+        usage();
+      }
+      return num;
+    };
+    if (arg == "--min"sv)         { opts.min_size = size(); }
+    else if (arg == "--max"sv)    { opts.max_size = size(); }
+    else if (arg == "--filter"sv) { opts.filter = value(); }
+    else if (arg == "--format"sv) {
+      opts.format = value();
+      if (opts.format != "table"sv && opts.format != "csv"sv && opts.format != "json"sv) {
+        std::cerr << "unknown format "s << opts.format << '\n';
+        usage();
+      }
+    }
+    else if (arg == "--out"sv)    { opts.out = value(); }
+    else {
+      usage();
+    }
+  }
+  return opts;
+}
+
+} /* namespace bench */
+
+//  ....+....!....+....!....+....!....+....!....+....!....+....!....+....!....+....!
+/*
+ *  MARK: main()
+ */
+int main(int argc, const char * argv[]) {
+  bench::suite st { bench::parse(argc, argv) };
+
+  if (st.opts().format == "table"s) {
+    std::cout << "CF.STL_Containers_List_Bench\n"s;
+  }
+
+  for (auto count = std::max<std::size_t>(st.opts().min_size, 1); count <= st.opts().max_size; count *= 10) {
+    auto const vals = bench::make_values(count);
+    bench::container_cases<std::list<int>>(st, "std::list<int>"sv, vals);
+    bench::container_cases<clst::pooled_list<int>>(st, "clst::pooled_list<int>"sv, vals);
+    bench::container_cases<clst::unrolled_list<int>>(st, "clst::unrolled_list<int>"sv, vals);
+    bench::container_cases<clst::compact_list<int>>(st, "clst::compact_list<int>"sv, vals);
+    bench::container_cases<std::vector<int>>(st, "std::vector<int>"sv, vals);
+    bench::container_cases<std::deque<int>>(st, "std::deque<int>"sv, vals);
+    bench::sort_cases(st, vals);
+    bench::compare_cases(st, vals);
+    bench::lookup_cases(st, vals);
+    bench::position_cases(st, vals);
+    bench::sorted_cases(st, vals);
+    bench::restart_cases(st, vals);
+    bench::external_cases(st, vals);
+    bench::footprint_cases(st, vals);
+    bench::bulk_cases(st, vals);
+    bench::dedup_cases(st, vals);
+    bench::par_cases(st, vals);
+    bench::pipeline_cases(st, vals);
+    bench::compact_cases(st, vals);
+    bench::string_cases(st, vals);
+    bench::concurrent_cases(st, vals);
+    bench::format_cases(st, vals);
+    if (st.opts().format == "table"s) {
+      std::cout << '\n';
+    }
+  }
+
+  st.write();
+
+  return st.failed() ? 1 : 0;
+}
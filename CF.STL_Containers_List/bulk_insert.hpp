@@ -0,0 +1,146 @@
+//
+//  bulk_insert.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: https://en.cppreference.com/w/cpp/container/list/insert_range
+//  @see: https://en.cppreference.com/w/cpp/container/list/splice
+//
+
+#ifndef bulk_insert_hpp
+#define bulk_insert_hpp
+
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <ranges>
+#include <utility>
+
+#include "node_pool.hpp"
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst
+namespace clst {
+
+/*
+ *  MARK: bulk insertion
+ *  C++23's insert_range, append_range and assign_range, and resize, for lists
+ *  drawing on a node_pool.  The batch's nodes are reserved as one run of
+ *  adjacent blocks (see node_pool::reserve), so they sit in memory in the
+ *  order the list visits them, and the batch is built in a list of its own
+ *  and spliced in: if constructing an element throws, the target list is left
+ *  as it was.  Ranges whose size is not known up front are still inserted
+ *  all-or-nothing, from whatever blocks the pool has.
+ */
+template<typename T, typename E>
+using bulk_list = std::list<T, pool_allocator<T, E>>;
+
+namespace detail {
+
+//  Holds a node_pool reservation for one batch and drops what is left of it.
+template<typename E>
+class pool_reservation {
+public:
+  pool_reservation(node_pool<E> & pool, std::size_t nodes) noexcept : pool_ { pool } { pool_.reserve(nodes); }
+  pool_reservation(pool_reservation const &) = delete;
+  pool_reservation & operator=(pool_reservation const &) = delete;
+  ~pool_reservation() { pool_.reserve(0); }
+
+private:
+  node_pool<E> & pool_;
+};
+
+template<typename R>
+auto batch_size(R && rg) -> std::size_t {
+  if constexpr (std::ranges::sized_range<R>) {
+    return static_cast<std::size_t>(std::ranges::size(rg));
+  }
+  else if constexpr (std::ranges::forward_range<R>) {
+    return static_cast<std::size_t>(std::ranges::distance(rg));
+  }
+  else {
+    return 0;
+  }
+}
+
+//  A list with lst's allocator holding a copy of every element of rg.
+template<typename T, typename E, typename R>
+auto make_batch(bulk_list<T, E> const & lst, R && rg) -> bulk_list<T, E> {
+  bulk_list<T, E> batch(lst.get_allocator());
+  pool_reservation<E> hold { *lst.get_allocator().pool(), batch_size(rg) };
+  if constexpr (std::ranges::common_range<R>) {
+    batch.insert(batch.end(), std::ranges::begin(rg), std::ranges::end(rg));
+  }
+  else {
+    for (auto && el : rg) {
+      batch.emplace_back(std::forward<decltype(el)>(el));
+    }
+  }
+  return batch;
+}
+
+} /* namespace detail */
+
+template<typename T, typename E, std::ranges::input_range R>
+auto insert_range(bulk_list<T, E> & lst, typename bulk_list<T, E>::const_iterator pos, R && rg)
+    -> typename bulk_list<T, E>::iterator {
+  auto batch = detail::make_batch(lst, std::forward<R>(rg));
+  if (batch.empty()) {
+    return lst.erase(pos, pos);
+  }
+  auto const first = batch.begin();
+  lst.splice(pos, batch);
+  return first;
+}
+
+template<typename T, typename E, std::ranges::input_range R>
+auto append_range(bulk_list<T, E> & lst, R && rg) -> void {
+  insert_range(lst, lst.cend(), std::forward<R>(rg));
+}
+
+template<typename T, typename E, std::ranges::input_range R>
+auto prepend_range(bulk_list<T, E> & lst, R && rg) -> void {
+  insert_range(lst, lst.cbegin(), std::forward<R>(rg));
+}
+
+//  Replaces the contents with fresh nodes in traversal order; the old nodes
+//  go back to the pool only once the new ones are all built.
+template<typename T, typename E, std::ranges::input_range R>
+auto assign_range(bulk_list<T, E> & lst, R && rg) -> void {
+  auto batch = detail::make_batch(lst, std::forward<R>(rg));
+  lst.swap(batch);
+}
+
+//  As lst.resize(), with the appended nodes allocated as one run.
+template<typename T, typename E>
+auto resize(bulk_list<T, E> & lst, std::size_t count) -> void {
+  if (count <= lst.size()) {
+    lst.resize(count);
+    return;
+  }
+  bulk_list<T, E> batch(lst.get_allocator());
+  {
+    detail::pool_reservation<E> hold { *lst.get_allocator().pool(), count - lst.size() };
+    batch.resize(count - lst.size());
+  }
+  lst.splice(lst.end(), batch);
+}
+
+template<typename T, typename E>
+auto resize(bulk_list<T, E> & lst, std::size_t count, T const & value) -> void {
+  if (count <= lst.size()) {
+    lst.resize(count);
+    return;
+  }
+  bulk_list<T, E> batch(lst.get_allocator());
+  {
+    detail::pool_reservation<E> hold { *lst.get_allocator().pool(), count - lst.size() };
+    batch.assign(count - lst.size(), value);
+  }
+  lst.splice(lst.end(), batch);
+}
+
+} /* namespace clst */
+
+#endif /* bulk_insert_hpp */
@@ -0,0 +1,539 @@
+//
+//  compact_list.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: https://en.cppreference.com/w/cpp/container/list
+//  @see: https://en.wikipedia.org/wiki/Free_list
+//
+
+#ifndef compact_list_hpp
+#define compact_list_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <compare>
+
+#include "synth_three_way.hpp"
+#include "index_links.hpp"
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst
+namespace clst {
+
+/*
+ *  MARK: compact_list
+ *  Doubly linked list whose nodes are slots in two parallel vectors, the
+ *  values and their prev/next links as Index-sized slot numbers, with erased
+ *  slots kept on a free list for reuse.  A std::list<int> node costs 24 bytes
+ *  plus the allocator's header; here it is 4 bytes of value and 8 of links,
+ *  and growing the list is an amortised vector append, not a call to new.
+ *
+ *  A handle is an element's slot number.  It stays valid, in this list, until
+ *  the element is erased, and survives growth, sort, splice, copy and swap
+ *  (copies keep the same slot numbers).
+ *
+ *  Differences from std::list:
+ *  - T must be default constructible; an erased slot is reset to T() until
+ *    it is reused.
+ *  - iterators hold the list's address and a slot number: growth keeps them
+ *    valid, but moving or swapping the list does not.
+ *  - splice within the list relinks, O(1) for any range.  Splice and merge
+ *    from another compact_list move the elements into this one's slots.
+ *  - at most numeric_limits<Index>::max() - 1 elements.
+ */
+template<typename T, typename Index = std::uint32_t>
+class compact_list {
+  static_assert(std::is_unsigned_v<Index>, "clst::compact_list: Index must be an unsigned integer");
+  static_assert(std::is_default_constructible_v<T>, "clst::compact_list: T must be default constructible");
+
+  //  Slot 0 holds the sentinel's links; slot ix > 0 holds values_[ix - 1].
+  static constexpr Index head = 0;
+
+  struct link {
+    Index prev = head;
+    Index next = head;
+  };
+
+  template<bool Const>
+  class basic_iterator {
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, T const *, T *>;
+    using reference = std::conditional_t<Const, T const &, T &>;
+
+    basic_iterator() = default;
+    template<bool C = Const, typename = std::enable_if_t<C>>
+    basic_iterator(basic_iterator<false> const & other) noexcept : lst_ { other.lst_ }, ix_ { other.ix_ } {}
+
+    auto operator*() const -> reference { return lst_->values_[ix_ - 1]; }
+    auto operator->() const -> pointer { return lst_->values_.data() + (ix_ - 1); }
+
+    auto operator++() -> basic_iterator & { ix_ = lst_->links_[ix_].next; return *this; }
+    auto operator++(int) -> basic_iterator { auto tmp = *this; ++*this; return tmp; }
+    auto operator--() -> basic_iterator & { ix_ = lst_->links_[ix_].prev; return *this; }
+    auto operator--(int) -> basic_iterator { auto tmp = *this; --*this; return tmp; }
+
+    friend auto operator==(basic_iterator const & lhs, basic_iterator const & rhs) -> bool {
+      return lhs.lst_ == rhs.lst_ && lhs.ix_ == rhs.ix_;
+    }
+
+  private:
+    friend class compact_list;
+    friend class basic_iterator<!Const>;
+
+    basic_iterator(compact_list const * lst, Index ix) noexcept
+      : lst_ { const_cast<compact_list *>(lst) }, ix_ { ix } {}
+
+    compact_list * lst_ = nullptr;
+    Index ix_ = head;
+  };
+
+public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T &;
+  using const_reference = T const &;
+  using pointer = T *;
+  using const_pointer = T const *;
+  using iterator = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+  using handle = Index;
+
+  //  Bytes of link per element, against the 2 * sizeof(void *) of a std::list node.
+  static constexpr std::size_t link_bytes = 2 * sizeof(Index);
+
+  //  MARK: construct/copy/destroy
+  compact_list() : links_(1) {}
+
+  explicit compact_list(size_type count) : compact_list() { resize(count); }
+  compact_list(size_type count, T const & value) : compact_list() { insert(end(), count, value); }
+
+  template<typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  compact_list(InputIt first, InputIt last) : compact_list() { insert(end(), first, last); }
+
+  compact_list(std::initializer_list<T> init) : compact_list(init.begin(), init.end()) {}
+
+  compact_list(compact_list const &) = default;
+
+  //  Leaves other empty, which takes one link for its sentinel.
+  compact_list(compact_list && other)
+    : links_ { std::move(other.links_) }, values_ { std::move(other.values_) },
+      free_ { other.free_ }, size_ { other.size_ } {
+    other.reset();
+  }
+
+  ~compact_list() = default;
+
+  auto operator=(compact_list const &) -> compact_list & = default;
+
+  auto operator=(compact_list && other) -> compact_list & {
+    if (this != &other) {
+      links_ = std::move(other.links_);
+      values_ = std::move(other.values_);
+      free_ = other.free_;
+      size_ = other.size_;
+      other.reset();
+    }
+    return *this;
+  }
+
+  auto operator=(std::initializer_list<T> init) -> compact_list & {
+    assign(init.begin(), init.end());
+    return *this;
+  }
+
+  auto assign(size_type count, T const & value) -> void {
+    clear();
+    insert(end(), count, value);
+  }
+
+  template<typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  auto assign(InputIt first, InputIt last) -> void {
+    clear();
+    insert(end(), first, last);
+  }
+
+  auto assign(std::initializer_list<T> init) -> void { assign(init.begin(), init.end()); }
+
+  //  MARK: element access
+  auto front() -> reference { return values_[links_[head].next - 1]; }
+  auto front() const -> const_reference { return values_[links_[head].next - 1]; }
+  auto back() -> reference { return values_[links_[head].prev - 1]; }
+  auto back() const -> const_reference { return values_[links_[head].prev - 1]; }
+
+  //  MARK: handles
+  auto handle_of(const_iterator pos) const noexcept -> handle { return pos.ix_; }
+  auto iterator_to(handle hd) noexcept -> iterator { return iterator(this, hd); }
+  auto iterator_to(handle hd) const noexcept -> const_iterator { return const_iterator(this, hd); }
+
+  //  MARK: iterators
+  auto begin() noexcept -> iterator { return iterator(this, links_[head].next); }
+  auto begin() const noexcept -> const_iterator { return const_iterator(this, links_[head].next); }
+  auto cbegin() const noexcept -> const_iterator { return begin(); }
+  auto end() noexcept -> iterator { return iterator(this, head); }
+  auto end() const noexcept -> const_iterator { return const_iterator(this, head); }
+  auto cend() const noexcept -> const_iterator { return end(); }
+  auto rbegin() noexcept -> reverse_iterator { return reverse_iterator(end()); }
+  auto rbegin() const noexcept -> const_reverse_iterator { return const_reverse_iterator(end()); }
+  auto crbegin() const noexcept -> const_reverse_iterator { return rbegin(); }
+  auto rend() noexcept -> reverse_iterator { return reverse_iterator(begin()); }
+  auto rend() const noexcept -> const_reverse_iterator { return const_reverse_iterator(begin()); }
+  auto crend() const noexcept -> const_reverse_iterator { return rend(); }
+
+  //  MARK: capacity
+  [[nodiscard]] auto empty() const noexcept -> bool { return size_ == 0; }
+  auto size() const noexcept -> size_type { return size_; }
+  static constexpr auto max_size() noexcept -> size_type {
+    return std::min<size_type>(std::numeric_limits<Index>::max() - 1, std::numeric_limits<difference_type>::max());
+  }
+
+  //  Slots allocated, in use or free.
+  auto capacity() const noexcept -> size_type { return values_.capacity(); }
+
+  auto reserve(size_type count) -> void {
+    if (count > max_size()) {
+      throw std::length_error("clst::compact_list: too many elements for Index");
+    }
+    values_.reserve(count);
+    links_.reserve(count + 1);
+  }
+
+  //  Gives back unused vector capacity; free slots in the middle stay.
+  auto shrink_to_fit() -> void {
+    values_.shrink_to_fit();
+    links_.shrink_to_fit();
+  }
+
+  //  Heap bytes held by the list: both vectors at their current capacity.
+  auto memory_bytes() const noexcept -> size_type {
+    return values_.capacity() * sizeof(T) + links_.capacity() * sizeof(link);
+  }
+
+  //  MARK: modifiers
+  auto clear() noexcept -> void {
+    values_.clear();
+    links_.resize(1);
+    links_[head] = link {};
+    free_ = head;
+    size_ = 0;
+  }
+
+  auto insert(const_iterator pos, T const & value) -> iterator { return emplace(pos, value); }
+  auto insert(const_iterator pos, T && value) -> iterator { return emplace(pos, std::move(value)); }
+
+  auto insert(const_iterator pos, size_type count, T const & value) -> iterator {
+    auto ret = iterator(this, pos.ix_);
+    for (size_type ix = 0; ix < count; ++ix) {
+      auto it = emplace(pos, value);
+      if (ix == 0) {
+        ret = it;
+      }
+    }
+    return ret;
+  }
+
+  template<typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  auto insert(const_iterator pos, InputIt first, InputIt last) -> iterator {
+    auto ret = iterator(this, pos.ix_);
+    auto inserted = false;
+    for (; first != last; ++first) {
+      auto it = emplace(pos, *first);
+      if (!inserted) {
+        ret = it;
+        inserted = true;
+      }
+    }
+    return ret;
+  }
+
+  auto insert(const_iterator pos, std::initializer_list<T> init) -> iterator {
+    return insert(pos, init.begin(), init.end());
+  }
+
+  template<typename... Args>
+  auto emplace(const_iterator pos, Args &&... args) -> iterator {
+    auto const ix = acquire(std::forward<Args>(args)...);
+    auto const at = pos.ix_;
+    auto const prev = links_[at].prev;
+    links_[ix] = link { prev, at, };
+    links_[prev].next = ix;
+    links_[at].prev = ix;
+    ++size_;
+    return iterator(this, ix);
+  }
+
+  auto erase(const_iterator pos) -> iterator {
+    auto const ix = pos.ix_;
+    auto const next = links_[ix].next;
+    unlink(ix);
+    release(ix);
+    --size_;
+    return iterator(this, next);
+  }
+
+  auto erase(const_iterator first, const_iterator last) -> iterator {
+    while (first != last) {
+      first = erase(first);
+    }
+    return iterator(this, last.ix_);
+  }
+
+  auto push_back(T const & value) -> void { emplace_back(value); }
+  auto push_back(T && value) -> void { emplace_back(std::move(value)); }
+
+  template<typename... Args>
+  auto emplace_back(Args &&... args) -> reference { return *emplace(end(), std::forward<Args>(args)...); }
+
+  auto pop_back() -> void { erase(const_iterator(this, links_[head].prev)); }
+
+  auto push_front(T const & value) -> void { emplace_front(value); }
+  auto push_front(T && value) -> void { emplace_front(std::move(value)); }
+
+  template<typename... Args>
+  auto emplace_front(Args &&... args) -> reference { return *emplace(begin(), std::forward<Args>(args)...); }
+
+  auto pop_front() -> void { erase(begin()); }
+
+  auto resize(size_type count) -> void {
+    while (size_ > count) {
+      pop_back();
+    }
+    while (size_ < count) {
+      emplace_back();
+    }
+  }
+
+  auto resize(size_type count, T const & value) -> void {
+    while (size_ > count) {
+      pop_back();
+    }
+    insert(end(), count - size_, value);
+  }
+
+  auto swap(compact_list & other) noexcept -> void {
+    using std::swap;
+    swap(links_, other.links_);
+    swap(values_, other.values_);
+    swap(free_, other.free_);
+    swap(size_, other.size_);
+  }
+
+  //  MARK: operations
+  auto merge(compact_list & other) -> void { merge(other, std::less<>()); }
+  auto merge(compact_list && other) -> void { merge(other, std::less<>()); }
+
+  template<typename Compare>
+  auto merge(compact_list && other, Compare comp) -> void { merge(other, comp); }
+
+  template<typename Compare>
+  auto merge(compact_list & other, Compare comp) -> void {
+    if (this == &other) {
+      return;
+    }
+    reserve(size_ + other.size_);
+    auto it = begin();
+    for (auto & el : other) {
+      while (it != end() && !comp(el, *it)) {
+        ++it;
+      }
+      emplace(it, std::move(el));
+    }
+    other.clear();
+  }
+
+  auto splice(const_iterator pos, compact_list & other) -> void {
+    if (this == &other) {
+      return;
+    }
+    reserve(size_ + other.size_);
+    insert(pos, std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+    other.clear();
+  }
+  auto splice(const_iterator pos, compact_list && other) -> void { splice(pos, other); }
+
+  auto splice(const_iterator pos, compact_list & other, const_iterator it) -> void {
+    splice(pos, other, it, std::next(it));
+  }
+  auto splice(const_iterator pos, compact_list && other, const_iterator it) -> void {
+    splice(pos, other, it, std::next(it));
+  }
+
+  auto splice(const_iterator pos, compact_list && other, const_iterator first, const_iterator last) -> void {
+    splice(pos, other, first, last);
+  }
+
+  auto splice(const_iterator pos, compact_list & other, const_iterator first, const_iterator last) -> void {
+    if (first == last) {
+      return;
+    }
+    if (this != &other) {
+      auto const from = iterator(&other, first.ix_);
+      auto const to = iterator(&other, last.ix_);
+      insert(pos, std::make_move_iterator(from), std::make_move_iterator(to));
+      other.erase(first, last);
+      return;
+    }
+    if (pos == first || pos == last) {
+      return;
+    }
+    //  Relink [first, last) in front of pos.
+    auto const lo = first.ix_;
+    auto const hi = links_[last.ix_].prev;
+    links_[links_[lo].prev].next = last.ix_;
+    links_[last.ix_].prev = links_[lo].prev;
+    auto const at = pos.ix_;
+    links_[lo].prev = links_[at].prev;
+    links_[links_[at].prev].next = lo;
+    links_[hi].next = at;
+    links_[at].prev = hi;
+  }
+
+  auto remove(T const & value) -> size_type {
+    T const val = value;  // 'value' may refer to an element that gets erased.
+    return remove_if([&val](T const & el) { return el == val; });
+  }
+
+  template<typename UnaryPredicate>
+  auto remove_if(UnaryPredicate pred) -> size_type {
+    auto const before = size_;
+    for (auto it = cbegin(); it != cend(); ) {
+      it = pred(*it) ? erase(it) : std::next(it);
+    }
+    return before - size_;
+  }
+
+  auto reverse() noexcept -> void {
+    auto ix = head;
+    do {
+      auto & lk = links_[ix];
+      std::swap(lk.prev, lk.next);
+      ix = lk.prev;
+    } while (ix != head);
+  }
+
+  auto unique() -> size_type { return unique(std::equal_to<>()); }
+
+  template<typename BinaryPredicate>
+  auto unique(BinaryPredicate pred) -> size_type {
+    auto const before = size_;
+    if (size_ > 1) {
+      for (auto kept = cbegin(), it = std::next(kept); it != cend(); ) {
+        if (pred(*kept, *it)) {
+          it = erase(it);
+        }
+        else {
+          kept = it++;
+        }
+      }
+    }
+    return before - size_;
+  }
+
+  auto sort() -> void { sort(std::less<>()); }
+
+  //  Stable merge sort that relinks the slots; values and handles stay put.
+  template<typename Compare>
+  auto sort(Compare comp) -> void {
+    detail::sort_index_links(links_, head, [this, &comp](Index lhs, Index rhs) {
+      return comp(values_[lhs - 1], values_[rhs - 1]);
+    });
+  }
+
+private:
+  //  A slot holding T(args...): the last one released, else a new one at
+  //  the end of both vectors.
+  template<typename... Args>
+  auto acquire(Args &&... args) -> Index {
+    if (free_ != head) {
+      auto const ix = free_;
+      values_[ix - 1] = T(std::forward<Args>(args)...);
+      free_ = links_[ix].next;
+      return ix;
+    }
+    if (size_ == max_size()) {
+      throw std::length_error("clst::compact_list: too many elements for Index");
+    }
+    values_.emplace_back(std::forward<Args>(args)...);
+    try {
+      links_.emplace_back();
+    }
+    catch (...) {
+      values_.pop_back();
+      throw;
+    }
+    return static_cast<Index>(links_.size() - 1);
+  }
+
+  auto release(Index ix) noexcept -> void {
+    if constexpr (!std::is_trivially_copyable_v<T>) {
+      values_[ix - 1] = T();
+    }
+    links_[ix].next = free_;
+    free_ = ix;
+  }
+
+  auto unlink(Index ix) noexcept -> void {
+    links_[links_[ix].prev].next = links_[ix].next;
+    links_[links_[ix].next].prev = links_[ix].prev;
+  }
+
+  //  The empty list, after the vectors have been moved out.
+  auto reset() -> void {
+    links_.assign(1, link {});
+    values_.clear();
+    free_ = head;
+    size_ = 0;
+  }
+
+  std::vector<link> links_;
+  std::vector<T> values_;
+  Index free_ = head;     // released slots, chained through next
+  size_type size_ = 0;
+};
+
+//  MARK: non-member functions
+template<typename T, typename I>
+auto operator==(compact_list<T, I> const & lhs, compact_list<T, I> const & rhs) -> bool {
+  return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template<typename T, typename I>
+auto operator<=>(compact_list<T, I> const & lhs, compact_list<T, I> const & rhs) {
+  return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                                                detail::synth_three_way {});
+}
+
+template<typename T, typename I>
+auto swap(compact_list<T, I> & lhs, compact_list<T, I> & rhs) noexcept -> void {
+  lhs.swap(rhs);
+}
+
+template<typename T, typename I, typename U>
+auto erase(compact_list<T, I> & container, U const & value) -> typename compact_list<T, I>::size_type {
+  return container.remove_if([&value](auto const & el) { return el == value; });
+}
+
+template<typename T, typename I, typename Pred>
+auto erase_if(compact_list<T, I> & container, Pred pred) -> typename compact_list<T, I>::size_type {
+  return container.remove_if(pred);
+}
+
+} /* namespace clst */
+
+#endif /* compact_list_hpp */
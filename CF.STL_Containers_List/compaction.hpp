@@ -0,0 +1,217 @@
+//
+//  compaction.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: https://en.cppreference.com/w/cpp/container/list/splice
+//  @see: https://gcc.gnu.org/onlinedocs/gcc/Other-Builtins.html
+//
+
+#ifndef compaction_hpp
+#define compaction_hpp
+
+#include <cstddef>
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#include "node_pool.hpp"
+#include "bulk_insert.hpp"
+#include "stopwatch.hpp"
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst
+namespace clst {
+
+/*
+ *  MARK: list_compactor
+ *  Restores traversal locality to a list drawing on a node_pool, a step at a
+ *  time.  After erases, splices, merges and sorts the nodes of a list are
+ *  scattered over the pool's slabs; each step moves the next 'step' elements,
+ *  in list order, into one run of adjacent blocks (see node_pool::reserve),
+ *  splices the run in where they were and frees the old nodes.  A stretch
+ *  whose nodes are already adjacent is left alone, so compacting a compact
+ *  list costs one walk.  The runs always come from fresh slabs, so the step
+ *  that reaches the end of the list calls node_pool::trim(), giving back the
+ *  slabs the old nodes emptied; without that every pass would add a copy.
+ *
+ *  The elements keep their values and order; iterators and references to
+ *  the elements a step has moved are invalidated, those to the rest are not.
+ *  Elements are moved when moving them there and back cannot throw, and
+ *  moved back if the step fails; otherwise they are copied.  So a throwing
+ *  step leaves the list as it was, except for a type that can only be moved
+ *  and whose moves can throw, which gets the basic guarantee.  The list must
+ *  not be changed between steps: start a new compactor after changing it.
+ */
+template<typename T, typename E>
+class list_compactor {
+public:
+  using list_type = bulk_list<T, E>;
+
+  explicit list_compactor(list_type & lst, std::size_t step = node_pool<E>::max_chunk_nodes)
+    : lst_ { lst }, next_ { lst.begin() }, step_ { std::max<std::size_t>(step, 1) } {}
+
+  auto done() const noexcept -> bool { return next_ == lst_.end(); }
+
+  //  Compacts the next 'step' elements; false once the end is reached.
+  auto step() -> bool {
+    if (done()) {
+      return false;
+    }
+    auto const first = next_;
+    auto last = first;
+    std::size_t count = 0;
+    bool adjacent = true;
+    char const * prev = nullptr;
+    auto const block = static_cast<std::ptrdiff_t>(lst_.get_allocator().pool()->block_size());
+    for (; count != step_ && last != lst_.end(); ++count, ++last) {
+      auto const * here = address_of(last);
+      adjacent = adjacent && (prev == nullptr || here - prev == block);
+      prev = here;
+    }
+    if (!adjacent) {
+      list_type batch(lst_.get_allocator());
+      {
+        detail::pool_reservation<E> hold { *lst_.get_allocator().pool(), count };
+        try {
+          for (auto it = first; it != last; ++it) {
+            if constexpr (restorable || !std::is_copy_constructible_v<T>) {
+              batch.push_back(std::move(*it));
+            }
+            else {
+              batch.push_back(std::as_const(*it));
+            }
+          }
+        }
+        catch (...) {
+          if constexpr (restorable) {
+            std::move(batch.begin(), batch.end(), first);
+          }
+          throw;
+        }
+      }
+      lst_.splice(first, batch);
+      lst_.erase(first, last);
+      moved_ = true;
+    }
+    next_ = last;
+    if (done() && moved_) {
+      lst_.get_allocator().pool()->trim();
+    }
+    return !done();
+  }
+
+  //  Steps until budget has been spent or the list is done; false when done.
+  auto run_for(std::chrono::nanoseconds budget) -> bool {
+    stopwatch sw;
+    while (step()) {
+      if (sw.elapsed() >= budget) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+private:
+  static constexpr bool restorable = std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>;
+
+  static auto address_of(typename list_type::iterator it) noexcept -> char const * {
+    return reinterpret_cast<char const *>(std::addressof(*it));
+  }
+
+  list_type & lst_;
+  typename list_type::iterator next_;
+  std::size_t step_;
+  bool moved_ = false;
+};
+
+/*
+ *  MARK: compact()
+ *  The whole list in one go.
+ */
+template<typename T, typename E>
+auto compact(bulk_list<T, E> & lst) -> void {
+  list_compactor<T, E> compactor { lst };
+  while (compactor.step()) {
+  }
+}
+
+/*
+ *  MARK: prefetch_iterator
+ *  Forward iterator over a node-based range that keeps a second iterator
+ *  'distance' elements ahead and asks the CPU to prefetch that element.  The
+ *  look-ahead is still a pointer chase, so it pays only when the work per
+ *  element is longer than a hop - a scattered list with a non-trivial loop
+ *  body - and costs a little when it is not.  Without a prefetch builtin the
+ *  adapter only walks.
+ */
+template<std::forward_iterator It>
+class prefetch_iterator {
+public:
+  using iterator_concept = std::forward_iterator_tag;
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = std::iter_value_t<It>;
+  using difference_type = std::iter_difference_t<It>;
+  using reference = std::iter_reference_t<It>;
+
+  prefetch_iterator() = default;
+  prefetch_iterator(It cur, It end, std::size_t distance) : cur_ { cur }, ahead_ { cur }, end_ { end } {
+    for (; distance != 0 && ahead_ != end_; --distance) {
+      ++ahead_;
+    }
+  }
+
+  auto operator*() const -> reference { return *cur_; }
+  auto operator->() const -> It { return cur_; }
+
+  auto operator++() -> prefetch_iterator & {
+    ++cur_;
+    if (ahead_ != end_) {
+      prefetch(std::addressof(*ahead_));
+      ++ahead_;
+    }
+    return *this;
+  }
+  auto operator++(int) -> prefetch_iterator {
+    auto was = *this;
+    ++*this;
+    return was;
+  }
+
+  auto base() const -> It { return cur_; }
+
+  friend auto operator==(prefetch_iterator const & lhs, prefetch_iterator const & rhs) -> bool {
+    return lhs.cur_ == rhs.cur_;
+  }
+
+private:
+  static auto prefetch([[maybe_unused]] void const * addr) noexcept -> void {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(addr);
+#endif
+  }
+
+  It cur_ {};
+  It ahead_ {};
+  It end_ {};
+};
+
+//  rg as a range of prefetch_iterators, for range-for and the algorithms.
+template<std::ranges::forward_range R>
+  requires std::ranges::common_range<R>
+auto prefetched(R & rg, std::size_t distance = 8) {
+  using It = std::ranges::iterator_t<R>;
+  auto const first = std::ranges::begin(rg);
+  auto const last = std::ranges::end(rg);
+  return std::ranges::subrange(prefetch_iterator<It> { first, last, distance },
+                               prefetch_iterator<It> { last, last, 0 });
+}
+
+} /* namespace clst */
+
+#endif /* compaction_hpp */
@@ -0,0 +1,248 @@
+//
+//  concurrent_list.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: https://timharris.uk/papers/2001-disc.pdf
+//  @see: https://en.cppreference.com/w/cpp/atomic/atomic/compare_exchange
+//
+
+#ifndef concurrent_list_hpp
+#define concurrent_list_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <functional>
+#include <optional>
+#include <utility>
+
+#include "epoch.hpp"
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst
+namespace clst {
+
+/*
+ *  MARK: concurrent_list
+ *  Lock-free singly linked list after Harris: any number of threads may call
+ *  any member except the destructor at the same time.
+ *
+ *  An element is removed in two steps.  Setting the low bit of its node's next
+ *  pointer deletes it logically; after that no insert can link behind it and
+ *  every traversal skips it.  Unlinking it is then a single compare-and-swap on
+ *  its predecessor, done by the remover or by the next traversal to pass by.
+ *  Unlinked nodes are handed to epoch_domain and freed once no thread can
+ *  still be reading them, so a traversal never touches freed memory and a
+ *  recycled address cannot fool a compare-and-swap.
+ *
+ *  Elements are never modified in place, and there are no iterators: find_if
+ *  returns a copy and for_each visits a weakly consistent snapshot.
+ */
+template<typename T>
+class concurrent_list {
+  struct node {
+    template<typename... Args>
+    explicit node(Args &&... args) : value (std::forward<Args>(args)...) {}
+
+    T const value;
+    std::atomic<std::uintptr_t> next { 0 };
+  };
+
+  static constexpr std::uintptr_t deleted = 1;
+
+  static auto as_node(std::uintptr_t link) noexcept -> node * { return reinterpret_cast<node *>(link & ~deleted); }
+  static auto as_link(node * nd) noexcept -> std::uintptr_t { return reinterpret_cast<std::uintptr_t>(nd); }
+  static auto is_deleted(std::uintptr_t link) noexcept -> bool { return (link & deleted) != 0; }
+
+public:
+  using value_type = T;
+  using size_type = std::size_t;
+
+  concurrent_list() = default;
+
+  concurrent_list(concurrent_list const &) = delete;
+  concurrent_list & operator=(concurrent_list const &) = delete;
+
+  //  Not thread-safe: no other thread may be using the list.
+  ~concurrent_list() {
+    auto * nd = as_node(head_.load(std::memory_order_acquire));
+    while (nd != nullptr) {
+      auto * nx = as_node(nd->next.load(std::memory_order_relaxed));
+      delete nd;
+      nd = nx;
+    }
+  }
+
+  //  Number of live elements; exact only while no other thread is modifying.
+  auto size() const noexcept -> size_type {
+    auto const count = size_.load(std::memory_order_relaxed);
+    return count < 0 ? 0 : static_cast<size_type>(count);
+  }
+  [[nodiscard]] auto empty() const noexcept -> bool { return size() == 0; }
+
+  auto push_front(T value) -> void {
+    auto * nd = new node(std::move(value));
+    auto cur = head_.load(std::memory_order_relaxed);
+    do {
+      nd->next.store(cur, std::memory_order_relaxed);
+    } while (!head_.compare_exchange_weak(cur, as_link(nd), std::memory_order_release, std::memory_order_relaxed));
+    size_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  //  Whether some live element equals value.
+  auto find(T const & value) const -> bool {
+    return find_if([&value](T const & el) { return el == value; }).has_value();
+  }
+
+  //  A copy of the first live element satisfying pred.
+  template<typename Pred>
+  auto find_if(Pred pred) const -> std::optional<T> {
+    epoch_guard guard;
+    for (auto * nd = as_node(head_.load(std::memory_order_acquire)); nd != nullptr; ) {
+      auto const nx = nd->next.load(std::memory_order_acquire);
+      if (!is_deleted(nx) && pred(nd->value)) {
+        return nd->value;
+      }
+      nd = as_node(nx);
+    }
+    return std::nullopt;
+  }
+
+  //  Insert value in front of the first live element equal to pos_value.
+  //  Returns false, inserting nothing, when there is none.
+  auto insert_before(T const & pos_value, T value) -> bool {
+    epoch_guard guard;
+    node * nd = nullptr;
+    for (;;) {
+      auto const [link, at] = search([&pos_value](T const & el) { return el == pos_value; });
+      if (at == nullptr) {
+        delete nd;
+        return false;
+      }
+      if (nd == nullptr) {
+        nd = new node(std::move(value));
+      }
+      nd->next.store(as_link(at), std::memory_order_relaxed);
+      auto expected = as_link(at);
+      if (link->compare_exchange_strong(expected, as_link(nd), std::memory_order_release, std::memory_order_relaxed)) {
+        size_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+      }
+    }
+  }
+
+  //  Remove every live element equal to value; returns how many this call removed.
+  auto remove(T const & value) -> size_type {
+    return remove_if([&value](T const & el) { return el == value; });
+  }
+
+  //  One pass: mark each match, then try to unlink it from the last live
+  //  predecessor.  Deleted nodes found on the way are unlinked as well.  If an
+  //  unlink loses a race, a final search clears up what is left.
+  template<typename Pred>
+  auto remove_if(Pred pred) -> size_type {
+    epoch_guard guard;
+    size_type removed = 0;
+    auto leftover = false;
+    auto * link = &head_;
+    auto cur = link->load(std::memory_order_acquire);
+    while (auto * nd = as_node(cur)) {
+      auto nx = nd->next.load(std::memory_order_acquire);
+      if (!is_deleted(nx) && pred(nd->value)) {
+        while (!is_deleted(nx)
+               && !nd->next.compare_exchange_weak(nx, nx | deleted, std::memory_order_acq_rel, std::memory_order_acquire)) {
+        }
+        //  A concurrent remove may have marked it first; only one of us counts it.
+        if (!is_deleted(nx)) {
+          ++removed;
+          nx |= deleted;
+        }
+      }
+      if (!is_deleted(nx)) {
+        link = &nd->next;
+        cur = nx;
+        continue;
+      }
+      auto const succ = nx & ~deleted;
+      auto expected = cur;
+      if (link->compare_exchange_strong(expected, succ, std::memory_order_acq_rel, std::memory_order_acquire)) {
+        retire(nd);
+      }
+      else {
+        leftover = true;
+        link = &nd->next;  // marked, so no unlink through it succeeds until the next live node
+      }
+      cur = succ;
+    }
+    if (removed != 0) {
+      size_.fetch_sub(static_cast<std::ptrdiff_t>(removed), std::memory_order_relaxed);
+    }
+    if (leftover) {
+      search([](T const &) { return false; });
+    }
+    return removed;
+  }
+
+  //  Visit each element live at the time the traversal reaches it.
+  template<typename Fn>
+  auto for_each(Fn fn) const -> void {
+    epoch_guard guard;
+    for (auto * nd = as_node(head_.load(std::memory_order_acquire)); nd != nullptr; ) {
+      auto const nx = nd->next.load(std::memory_order_acquire);
+      if (!is_deleted(nx)) {
+        fn(nd->value);
+      }
+      nd = as_node(nx);
+    }
+  }
+
+private:
+  static auto retire(node * nd) -> void {
+    epoch_domain::shared().retire(nd, [](void * ptr) { delete static_cast<node *>(ptr); });
+  }
+
+  //  Find the first live node satisfying pred and the link that points to it,
+  //  unlinking and retiring deleted nodes on the way.  Starts again from the
+  //  head when an unlink loses a race.  Call while pinned.
+  template<typename Pred>
+  auto search(Pred pred) -> std::pair<std::atomic<std::uintptr_t> *, node *> {
+    for (;;) {
+      auto * link = &head_;
+      auto cur = link->load(std::memory_order_acquire);
+      auto restart = false;
+      while (!restart) {
+        auto * nd = as_node(cur);
+        if (nd == nullptr) {
+          return { link, nullptr, };
+        }
+        auto const nx = nd->next.load(std::memory_order_acquire);
+        if (is_deleted(nx)) {
+          auto const succ = nx & ~deleted;
+          if (link->compare_exchange_strong(cur, succ, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            retire(nd);
+            cur = succ;
+          }
+          else {
+            restart = true;
+          }
+        }
+        else if (pred(nd->value)) {
+          return { link, nd, };
+        }
+        else {
+          link = &nd->next;
+          cur = nx;
+        }
+      }
+    }
+  }
+
+  std::atomic<std::uintptr_t> head_ { 0 };
+  std::atomic<std::ptrdiff_t> size_ { 0 };  // an insert may be counted after its removal
+};
+
+} /* namespace clst */
+
+#endif /* concurrent_list_hpp */
@@ -0,0 +1,66 @@
+//
+//  dedup.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: https://en.cppreference.com/w/cpp/container/list/unique
+//  @see: https://en.wikipedia.org/wiki/Open_addressing
+//
+
+#ifndef dedup_hpp
+#define dedup_hpp
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include "open_hash.hpp"
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst
+namespace clst {
+
+/*
+ *  MARK: dedup()
+ *  Erase every element equal to one before it, wherever it is, keeping the
+ *  first of each value in its place: the whole-list counterpart of unique(),
+ *  in one pass and O(n) expected time instead of sort + unique.  Returns the
+ *  number of elements erased, like std::erase_if.
+ *
+ *  The elements kept so far are indexed by address in an open_index sized
+ *  from size(), so no value is copied or hashed twice and erased nodes are
+ *  simply unlinked.  This needs a list whose erase leaves the other elements
+ *  where they are: std::list, pooled_list, compact_list, static_list,
+ *  indexed_sequence - not unrolled_list, which shifts elements in a chunk.
+ */
+template<typename List,
+         typename Hash = std::hash<typename List::value_type>,
+         typename Eq = std::equal_to<typename List::value_type>>
+auto dedup(List & lst, Hash hash = Hash(), Eq eq = Eq()) -> typename List::size_type {
+  using value_type = typename List::value_type;
+  struct key_of {
+    auto operator()(value_type const * el) const noexcept -> value_type const & { return *el; }
+  };
+
+  open_index<value_type const *, value_type, key_of, Hash, Eq> seen { key_of {}, std::move(hash), std::move(eq) };
+  seen.reserve(lst.size());
+  typename List::size_type erased = 0;
+  for (auto it = lst.begin(); it != lst.end(); ) {
+    auto const hv = seen.hash_of(*it);
+    if (seen.find(*it, hv) != nullptr) {
+      it = lst.erase(it);
+      ++erased;
+    }
+    else {
+      seen.insert(std::addressof(*it), hv);
+      ++it;
+    }
+  }
+  return erased;
+}
+
+} /* namespace clst */
+
+#endif /* dedup_hpp */
@@ -0,0 +1,199 @@
+//
+//  epoch.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: https://www.cl.cam.ac.uk/techreports/UCAM-CL-TR-579.pdf
+//  @see: https://en.cppreference.com/w/cpp/atomic/memory_order
+//
+
+#ifndef epoch_hpp
+#define epoch_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst
+namespace clst {
+
+/*
+ *  MARK: epoch_domain
+ *  Epoch-based reclamation for lock-free structures.
+ *
+ *  A thread pins the domain (epoch_guard) around every access to shared nodes.
+ *  A node that has been unlinked is retired rather than deleted; it is freed
+ *  once the global epoch has advanced twice past the epoch it was retired in,
+ *  by which time every thread that could still hold a pointer to it has unpinned.
+ *  The epoch advances only when every pinned thread has seen the current one.
+ *
+ *  There is one process-wide domain.  Per-thread records are allocated on first
+ *  use and recycled when their thread exits; nodes a thread leaves behind are
+ *  handed to the domain and freed by whichever thread collects next.
+ */
+class epoch_domain {
+public:
+  //  A thread tries to collect after retiring this many nodes.
+  static constexpr std::size_t collect_every = 64;
+
+  static auto shared() -> epoch_domain & {
+    static auto * domain = new epoch_domain;  // never destroyed: threads may outlive statics
+    return *domain;
+  }
+
+  epoch_domain(epoch_domain const &) = delete;
+  epoch_domain & operator=(epoch_domain const &) = delete;
+
+  auto pin() -> void {
+    auto & rec = local().rec;
+    if (rec->depth++ == 0) {
+      rec->epoch.store(global_.load(std::memory_order_relaxed) | pinned_bit, std::memory_order_relaxed);
+      //  Pairs with the fence in retire(): either this thread's loads see the
+      //  unlink, or the retiring thread's epoch is one this pin holds back.
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+  }
+
+  auto unpin() -> void {
+    auto & rec = local().rec;
+    if (--rec->depth == 0) {
+      rec->epoch.store(0, std::memory_order_release);
+    }
+  }
+
+  //  Free 'ptr' with 'del' once no pinned thread can reach it.  Call while pinned.
+  auto retire(void * ptr, void (* del)(void *)) -> void {
+    auto & loc = local();
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    loc.limbo.push_back(retired { ptr, del, global_.load(std::memory_order_relaxed), });
+    if (loc.limbo.size() >= loc.next_collect) {
+      collect(loc);
+      loc.next_collect = loc.limbo.size() + collect_every;
+    }
+  }
+
+  auto epoch() const noexcept -> std::uint64_t { return global_.load(std::memory_order_relaxed); }
+
+private:
+  static constexpr std::uint64_t pinned_bit = 1;
+  static constexpr std::uint64_t step = 2;  // epochs count in twos; bit 0 marks a pinned record
+
+  struct retired {
+    void * ptr;
+    void (* del)(void *);
+    std::uint64_t epoch;
+  };
+
+  struct alignas(64) record {
+    std::atomic<std::uint64_t> epoch { 0 };  // 0 when not pinned
+    std::atomic<bool> in_use { true };
+    record * next = nullptr;
+    std::size_t depth = 0;                   // nesting of pin(), owner thread only
+  };
+
+  //  What a thread keeps for itself: its record and the nodes it has retired.
+  struct thread_state {
+    record * rec;
+    std::vector<retired> limbo;
+    std::size_t next_collect = collect_every;
+
+    explicit thread_state(epoch_domain & dom) : rec { dom.acquire() } {}
+
+    ~thread_state() {
+      auto & dom = shared();
+      {
+        std::lock_guard<std::mutex> lock { dom.orphan_mtx_ };
+        dom.orphans_.insert(dom.orphans_.end(), limbo.begin(), limbo.end());
+      }
+      rec->in_use.store(false, std::memory_order_release);
+    }
+  };
+
+  epoch_domain() = default;
+
+  static auto local() -> thread_state & {
+    thread_local thread_state state { shared() };
+    return state;
+  }
+
+  //  Reuse a record released by an exited thread, or push a new one.
+  auto acquire() -> record * {
+    for (auto * rec = records_.load(std::memory_order_acquire); rec != nullptr; rec = rec->next) {
+      auto expected = false;
+      if (!rec->in_use.load(std::memory_order_relaxed)
+          && rec->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+        return rec;
+      }
+    }
+    auto * rec = new record;
+    rec->next = records_.load(std::memory_order_relaxed);
+    while (!records_.compare_exchange_weak(rec->next, rec, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+    return rec;
+  }
+
+  //  Advance the global epoch if every pinned thread has observed it.
+  auto try_advance() -> std::uint64_t {
+    auto cur = global_.load(std::memory_order_seq_cst);
+    for (auto * rec = records_.load(std::memory_order_acquire); rec != nullptr; rec = rec->next) {
+      auto const ep = rec->epoch.load(std::memory_order_seq_cst);
+      if ((ep & pinned_bit) != 0 && (ep & ~pinned_bit) != cur) {
+        return cur;
+      }
+    }
+    if (global_.compare_exchange_strong(cur, cur + step, std::memory_order_seq_cst)) {
+      return cur + step;
+    }
+    return cur;
+  }
+
+  static auto free_expired(std::vector<retired> & items, std::uint64_t now) -> void {
+    auto keep = items.begin();
+    for (auto & item : items) {
+      if (item.epoch + 2 * step <= now) {
+        item.del(item.ptr);
+      }
+      else {
+        *keep++ = item;
+      }
+    }
+    items.erase(keep, items.end());
+  }
+
+  auto collect(thread_state & loc) -> void {
+    auto const now = try_advance();
+    free_expired(loc.limbo, now);
+    std::unique_lock<std::mutex> lock { orphan_mtx_, std::try_to_lock };
+    if (lock.owns_lock() && !orphans_.empty()) {
+      free_expired(orphans_, now);
+    }
+  }
+
+  std::atomic<std::uint64_t> global_ { step };
+  std::atomic<record *> records_ { nullptr };
+  std::mutex orphan_mtx_;
+  std::vector<retired> orphans_;
+};
+
+/*
+ *  MARK: epoch_guard
+ *  Keeps the calling thread pinned for its lifetime.  Guards nest.
+ */
+class epoch_guard {
+public:
+  epoch_guard() { epoch_domain::shared().pin(); }
+
+  epoch_guard(epoch_guard const &) = delete;
+  epoch_guard & operator=(epoch_guard const &) = delete;
+
+  ~epoch_guard() { epoch_domain::shared().unpin(); }
+};
+
+} /* namespace clst */
+
+#endif /* epoch_hpp */
@@ -0,0 +1,372 @@
+//
+//  external_sort.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: https://en.wikipedia.org/wiki/External_sorting
+//  @see: https://en.wikipedia.org/wiki/K-way_merge_algorithm#Tournament_Tree
+//
+
+#ifndef external_sort_hpp
+#define external_sort_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "fast_sort.hpp"
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst
+namespace clst {
+
+/*
+ *  MARK: external_sort_options
+ *  memory_bytes bounds the memory the sorter uses at any one time: the run
+ *  being filled and sorted, and later the read buffers of the runs being
+ *  merged.  fan_in is how many runs are merged at once; with more runs than
+ *  that, groups of fan_in runs are first merged into longer runs on disk.
+ */
+struct external_sort_options {
+  std::size_t memory_bytes = std::size_t { 64 } << 20;
+  std::size_t fan_in = 16;
+  std::filesystem::path temp_dir = std::filesystem::temp_directory_path();
+};
+
+namespace detail {
+
+//  A sorted run on disk: sizeof(T) bytes per element, nothing else.
+template<typename T>
+class run_writer {
+public:
+  run_writer(std::filesystem::path const & path, std::size_t buffer_elems)
+    : file_ { path, std::ios::binary | std::ios::trunc } {
+    if (!file_) {
+      throw std::runtime_error("clst::external_sorter: cannot create " + path.string());
+    }
+    buf_.reserve(std::max<std::size_t>(buffer_elems, 1));
+  }
+
+  auto push(T const & value) -> void {
+    buf_.push_back(value);
+    if (buf_.size() == buf_.capacity()) {
+      flush();
+    }
+  }
+
+  auto close() -> void {
+    flush();
+    file_.close();
+    if (!file_) {
+      throw std::runtime_error("clst::external_sorter: write failed");
+    }
+  }
+
+  auto bytes() const noexcept -> std::uint64_t { return bytes_; }
+
+private:
+  auto flush() -> void {
+    auto const len = static_cast<std::streamsize>(buf_.size() * sizeof(T));
+    file_.write(reinterpret_cast<char const *>(buf_.data()), len);
+    if (!file_) {
+      throw std::runtime_error("clst::external_sorter: write failed");
+    }
+    bytes_ += static_cast<std::uint64_t>(len);
+    buf_.clear();
+  }
+
+  std::ofstream file_;
+  std::vector<T> buf_;
+  std::uint64_t bytes_ = 0;
+};
+
+template<typename T>
+class run_reader {
+public:
+  run_reader(std::filesystem::path const & path, std::size_t buffer_elems)
+    : file_ { path, std::ios::binary }, buf_(std::max<std::size_t>(buffer_elems, 1)) {
+    if (!file_) {
+      throw std::runtime_error("clst::external_sorter: cannot open " + path.string());
+    }
+    refill();
+  }
+
+  auto done() const noexcept -> bool { return pos_ == end_; }
+  auto current() const noexcept -> T const & { return buf_[pos_]; }
+
+  auto next() -> void {
+    if (++pos_ == end_) {
+      refill();
+    }
+  }
+
+private:
+  auto refill() -> void {
+    file_.read(reinterpret_cast<char *>(buf_.data()), static_cast<std::streamsize>(buf_.size() * sizeof(T)));
+    if (file_.bad() || file_.gcount() % static_cast<std::streamsize>(sizeof(T)) != 0) {
+      throw std::runtime_error("clst::external_sorter: read failed");
+    }
+    pos_ = 0;
+    end_ = static_cast<std::size_t>(file_.gcount()) / sizeof(T);
+  }
+
+  std::ifstream file_;
+  std::vector<T> buf_;
+  std::size_t pos_ = 0;
+  std::size_t end_ = 0;
+};
+
+/*
+ *  MARK: loser_tree
+ *  Tournament over k sources that yields their elements in order, taking
+ *  ceil(log2 k) comparisons per element: each inner node keeps the loser of
+ *  the match played there, so after the winner advances only the matches on
+ *  its own path to the root are replayed.  Ties go to the lower source, which
+ *  keeps the merge stable.
+ */
+template<typename Source, typename Compare>
+class loser_tree {
+public:
+  loser_tree(std::vector<Source> & sources, Compare comp)
+    : src_ { sources }, comp_ { std::move(comp) }, tree_(std::max<std::size_t>(sources.size(), 1), none) {
+    auto const k = src_.size();
+    //  Every inner node is reached by two contenders: the first waits there,
+    //  the second plays it and the winner moves up.
+    for (std::size_t leaf = 0; leaf < k; ++leaf) {
+      auto winner = leaf;
+      auto pos = (leaf + k) / 2;
+      for (; pos > 0; pos /= 2) {
+        if (tree_[pos] == none) {
+          tree_[pos] = winner;
+          break;
+        }
+        if (beats(tree_[pos], winner)) {
+          std::swap(tree_[pos], winner);
+        }
+      }
+      if (pos == 0) {
+        tree_[0] = winner;
+      }
+    }
+  }
+
+  auto done() const -> bool { return src_.empty() || src_[tree_[0]].done(); }
+  auto top() const -> decltype(auto) { return src_[tree_[0]].current(); }
+
+  //  Advance the source that supplied top() and replay its path.
+  auto pop() -> void {
+    auto winner = tree_[0];
+    src_[winner].next();
+    for (auto pos = (winner + src_.size()) / 2; pos > 0; pos /= 2) {
+      if (beats(tree_[pos], winner)) {
+        std::swap(tree_[pos], winner);
+      }
+    }
+    tree_[0] = winner;
+  }
+
+private:
+  static constexpr std::size_t none = static_cast<std::size_t>(-1);
+
+  //  Whether source lhs's element goes out before source rhs's.
+  auto beats(std::size_t lhs, std::size_t rhs) const -> bool {
+    if (src_[lhs].done()) {
+      return false;
+    }
+    if (src_[rhs].done()) {
+      return true;
+    }
+    auto const & lv = src_[lhs].current();
+    auto const & rv = src_[rhs].current();
+    return comp_(lv, rv) || (!comp_(rv, lv) && lhs < rhs);
+  }
+
+  std::vector<Source> & src_;
+  Compare comp_;
+  std::vector<std::size_t> tree_;
+};
+
+} /* namespace detail */
+
+/*
+ *  MARK: external_sorter
+ *  Stable sort of more trivially copyable elements than fit in memory.
+ *
+ *  push() collects elements in a std::list run sized to the memory budget;
+ *  a full run is sorted with fast_sort and written to a temporary file as raw
+ *  elements.  finish() merges the runs with a loser tree, fan_in at a time,
+ *  and hands the result to a callback in order.  Input that fits in one run
+ *  never touches the disk.  Temporary files are removed as soon as they have
+ *  been merged, and by the destructor.
+ */
+template<typename T, typename Compare = std::less<>>
+class external_sorter {
+  static_assert(std::is_trivially_copyable_v<T>, "clst::external_sorter writes T as raw bytes");
+
+public:
+  //  Memory charged to each element of a run: its list node and its entry in
+  //  fast_sort's buffer.
+  static constexpr std::size_t bytes_per_element = 2 * sizeof(T) + 4 * sizeof(void *);
+
+  struct stats {
+    std::size_t elements = 0;
+    std::size_t runs = 0;          // runs written by push()
+    std::size_t merge_passes = 0;  // passes over the data on disk, the final merge included
+    std::uint64_t bytes_written = 0;
+  };
+
+  explicit external_sorter(external_sort_options opts = {}, Compare comp = Compare())
+    : opts_ { std::move(opts) }, comp_ { std::move(comp) } {
+    opts_.fan_in = std::max<std::size_t>(opts_.fan_in, 2);
+    run_capacity_ = std::max<std::size_t>(opts_.memory_bytes / bytes_per_element, 1);
+    std::random_device rd;
+    prefix_ = std::string("clst-sort-") + std::to_string(rd()) + '-';
+  }
+
+  external_sorter(external_sorter const &) = delete;
+  external_sorter & operator=(external_sorter const &) = delete;
+
+  ~external_sorter() {
+    for (auto const & path : runs_) {
+      std::error_code ec;
+      std::filesystem::remove(path, ec);
+    }
+  }
+
+  auto statistics() const noexcept -> stats const & { return stats_; }
+  auto run_capacity() const noexcept -> std::size_t { return run_capacity_; }
+
+  auto push(T const & value) -> void {
+    run_.push_back(value);
+    ++stats_.elements;
+    if (run_.size() == run_capacity_) {
+      spill();
+    }
+  }
+
+  template<typename InputIt>
+  auto push(InputIt first, InputIt last) -> void {
+    for (; first != last; ++first) {
+      push(*first);
+    }
+  }
+
+  //  Call out(element) for every element pushed, in sorted order.  The
+  //  sorter is empty afterwards and can be used again.
+  template<typename Fn>
+  auto finish(Fn out) -> void {
+    if (runs_.empty()) {
+      fast_sort(run_, comp_);
+      for (auto const & el : run_) {
+        out(el);
+      }
+      run_.clear();
+      return;
+    }
+    if (!run_.empty()) {
+      spill();
+    }
+    //  Merge the oldest runs first, so equal elements keep their input order.
+    while (runs_.size() > opts_.fan_in) {
+      std::vector<std::filesystem::path> next;
+      for (std::size_t first = 0; first < runs_.size(); first += opts_.fan_in) {
+        auto const last = std::min(first + opts_.fan_in, runs_.size());
+        if (last - first == 1) {
+          next.push_back(runs_[first]);
+          continue;
+        }
+        auto path = make_path();
+        detail::run_writer<T> writer { path, buffer_elems() };
+        merge(first, last, [&writer](T const & el) { writer.push(el); });
+        writer.close();
+        stats_.bytes_written += writer.bytes();
+        next.push_back(std::move(path));
+      }
+      runs_ = std::move(next);
+      ++stats_.merge_passes;
+    }
+    merge(0, runs_.size(), out);
+    ++stats_.merge_passes;
+    runs_.clear();
+  }
+
+private:
+  auto buffer_elems() const -> std::size_t {
+    return std::max<std::size_t>(opts_.memory_bytes / (opts_.fan_in + 1) / sizeof(T), 1);
+  }
+
+  auto make_path() -> std::filesystem::path {
+    return opts_.temp_dir / (prefix_ + std::to_string(serial_++) + ".run");
+  }
+
+  auto spill() -> void {
+    fast_sort(run_, comp_);
+    auto path = make_path();
+    detail::run_writer<T> writer { path, buffer_elems() };
+    runs_.push_back(path);
+    for (auto const & el : run_) {
+      writer.push(el);
+    }
+    writer.close();
+    stats_.bytes_written += writer.bytes();
+    ++stats_.runs;
+    run_.clear();
+  }
+
+  //  k-way merge of runs_[first, last) into out; the merged files are removed.
+  template<typename Fn>
+  auto merge(std::size_t first, std::size_t last, Fn && out) -> void {
+    std::vector<detail::run_reader<T>> readers;
+    readers.reserve(last - first);
+    for (auto ix = first; ix < last; ++ix) {
+      readers.emplace_back(runs_[ix], buffer_elems());
+    }
+    detail::loser_tree<detail::run_reader<T>, Compare> tree { readers, comp_ };
+    for (; !tree.done(); tree.pop()) {
+      out(tree.top());
+    }
+    readers.clear();
+    for (auto ix = first; ix < last; ++ix) {
+      std::error_code ec;
+      std::filesystem::remove(runs_[ix], ec);
+    }
+  }
+
+  external_sort_options opts_;
+  Compare comp_;
+  std::size_t run_capacity_;
+  std::list<T> run_;
+  std::vector<std::filesystem::path> runs_;
+  std::string prefix_;
+  std::size_t serial_ = 0;
+  stats stats_;
+};
+
+/*
+ *  MARK: external_sort()
+ *  Sort [first, last) within opts.memory_bytes and write the result to out.
+ */
+template<typename InputIt, typename OutputIt, typename Compare = std::less<>>
+auto external_sort(InputIt first, InputIt last, OutputIt out, external_sort_options opts = {},
+                   Compare comp = Compare()) -> OutputIt {
+  external_sorter<typename std::iterator_traits<InputIt>::value_type, Compare> sorter { std::move(opts), comp };
+  sorter.push(first, last);
+  sorter.finish([&out](auto const & el) { *out++ = el; });
+  return out;
+}
+
+} /* namespace clst */
+
+#endif /* external_sort_hpp */
@@ -0,0 +1,85 @@
+//
+//  fast_sort.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: https://en.cppreference.com/w/cpp/container/list/sort
+//  @see: https://en.cppreference.com/w/cpp/container/list/splice
+//
+
+#ifndef fast_sort_hpp
+#define fast_sort_hpp
+
+#include <cstddef>
+#include <list>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst
+namespace clst {
+
+namespace detail {
+
+//  Small trivially copyable keys are cached next to the node handle so the
+//  sort never has to chase a node pointer to compare.
+template<typename T>
+inline constexpr bool cache_sort_key = std::is_trivially_copyable_v<T> && sizeof(T) <= 2 * sizeof(void *);
+
+} /* namespace detail */
+
+/*
+ *  MARK: fast_sort()
+ *  Drop-in for std::list::sort(comp) on large, cache-cold lists.
+ *
+ *  The node handles are gathered into one contiguous buffer, that buffer is
+ *  stable-sorted, and the nodes are relinked in that order with splice.  No
+ *  node is moved or reallocated and no element is assigned, so iterators and
+ *  references stay valid and, as with std::list::sort, equal elements keep
+ *  their relative order.  Needs size() handles of scratch space, each with a
+ *  copy of the key when T is small and trivially copyable.
+ */
+template<typename T, typename A, typename Compare = std::less<>>
+auto fast_sort(std::list<T, A> & lst, Compare comp = Compare()) -> void {
+  using iterator = typename std::list<T, A>::iterator;
+
+  if (lst.size() < 2) {
+    return;
+  }
+
+  if constexpr (detail::cache_sort_key<T>) {
+    struct keyed {
+      T key;
+      iterator it;
+    };
+    std::vector<keyed> buf;
+    buf.reserve(lst.size());
+    for (auto it = lst.begin(); it != lst.end(); ++it) {
+      buf.push_back(keyed { *it, it, });
+    }
+    std::stable_sort(buf.begin(), buf.end(),
+                     [&comp](keyed const & lhs, keyed const & rhs) { return comp(lhs.key, rhs.key); });
+    for (auto const & kd : buf) {
+      lst.splice(lst.end(), lst, kd.it);
+    }
+  }
+  else {
+    std::vector<iterator> buf;
+    buf.reserve(lst.size());
+    for (auto it = lst.begin(); it != lst.end(); ++it) {
+      buf.push_back(it);
+    }
+    std::stable_sort(buf.begin(), buf.end(),
+                     [&comp](iterator lhs, iterator rhs) { return comp(*lhs, *rhs); });
+    for (auto it : buf) {
+      lst.splice(lst.end(), lst, it);
+    }
+  }
+}
+
+} /* namespace clst */
+
+#endif /* fast_sort_hpp */
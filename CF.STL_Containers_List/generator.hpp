@@ -0,0 +1,138 @@
+//
+//  generator.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: https://en.cppreference.com/w/cpp/language/coroutines
+//  @see: https://en.cppreference.com/w/cpp/coroutine/generator
+//
+
+#ifndef generator_hpp
+#define generator_hpp
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst
+namespace clst {
+
+/*
+ *  MARK: generator
+ *  A coroutine that co_yields a sequence of T, read as a single-pass range.
+ *  Nothing runs until the first element is asked for, and each ++ resumes
+ *  the coroutine only as far as the next co_yield, so a generator can feed
+ *  a views pipeline (see list_views.hpp) without the sequence ever being
+ *  stored.  The yielded value is referred to, not copied: it lives until the
+ *  coroutine is resumed.  A subset of C++23's std::generator.
+ */
+template<typename T>
+class generator : public std::ranges::view_base {
+public:
+  using value_type = std::remove_cvref_t<T>;
+
+  class promise_type {
+  public:
+    auto get_return_object() noexcept -> generator {
+      return generator { std::coroutine_handle<promise_type>::from_promise(*this) };
+    }
+    auto initial_suspend() const noexcept -> std::suspend_always { return {}; }
+    auto final_suspend() const noexcept -> std::suspend_always { return {}; }
+
+    auto yield_value(value_type const & val) noexcept -> std::suspend_always {
+      current_ = std::addressof(val);
+      return {};
+    }
+    auto return_void() const noexcept -> void {}
+    auto unhandled_exception() noexcept -> void { exception_ = std::current_exception(); }
+
+    //  A generator only yields; it may not co_await.
+    template<typename U>
+    auto await_transform(U &&) -> std::suspend_never = delete;
+
+    auto value() const noexcept -> value_type const & { return *current_; }
+    auto rethrow() -> void {
+      if (exception_) {
+        std::rethrow_exception(std::exchange(exception_, nullptr));
+      }
+    }
+
+  private:
+    value_type const * current_ = nullptr;
+    std::exception_ptr exception_;
+  };
+
+  class iterator {
+  public:
+    using value_type = generator::value_type;
+    using difference_type = std::ptrdiff_t;
+    using iterator_concept = std::input_iterator_tag;
+
+    iterator() = default;
+
+    auto operator*() const noexcept -> value_type const & { return coro_.promise().value(); }
+
+    auto operator++() -> iterator & {
+      coro_.resume();
+      if (coro_.done()) {
+        coro_.promise().rethrow();
+      }
+      return *this;
+    }
+    auto operator++(int) -> void { ++*this; }
+
+    friend auto operator==(iterator const & it, std::default_sentinel_t) noexcept -> bool {
+      return !it.coro_ || it.coro_.done();
+    }
+
+  private:
+    friend class generator;
+    explicit iterator(std::coroutine_handle<promise_type> coro) noexcept : coro_ { coro } {}
+
+    std::coroutine_handle<promise_type> coro_ {};
+  };
+
+  generator() = default;
+  generator(generator && other) noexcept : coro_ { std::exchange(other.coro_, nullptr) } {}
+  generator & operator=(generator && other) noexcept {
+    if (this != &other) {
+      reset();
+      coro_ = std::exchange(other.coro_, nullptr);
+    }
+    return *this;
+  }
+  ~generator() { reset(); }
+
+  //  Runs the coroutine up to its first co_yield; call once.
+  auto begin() -> iterator {
+    iterator it { coro_ };
+    if (coro_) {
+      ++it;
+    }
+    return it;
+  }
+  auto end() const noexcept -> std::default_sentinel_t { return std::default_sentinel; }
+
+private:
+  explicit generator(std::coroutine_handle<promise_type> coro) noexcept : coro_ { coro } {}
+
+  auto reset() noexcept -> void {
+    if (coro_) {
+      coro_.destroy();
+      coro_ = nullptr;
+    }
+  }
+
+  std::coroutine_handle<promise_type> coro_ {};
+};
+
+} /* namespace clst */
+
+#endif /* generator_hpp */
@@ -0,0 +1,84 @@
+//
+//  index_links.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: https://www.chiark.greenend.org.uk/~sgtatham/algorithms/listsort.html
+//
+
+#ifndef index_links_hpp
+#define index_links_hpp
+
+#include <cstddef>
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst::detail
+namespace clst::detail {
+
+/*
+ *  MARK: sort_index_links()
+ *  Stable merge sort of a circular doubly linked list whose nodes are array
+ *  slots: links[ix].prev and links[ix].next are slot numbers, links[head] is
+ *  the sentinel and less(a, b) compares the elements in slots a and b.
+ *  Bottom-up over the next links (Tatham): O(n log n) comparisons and no
+ *  extra memory; the prev links are rebuilt at the end.
+ */
+template<typename Links, typename Index, typename Less>
+constexpr auto sort_index_links(Links & links, Index head, Less less) -> void {
+  auto list = links[head].next;
+  if (list == head || links[list].next == head) {
+    return;
+  }
+  for (std::size_t width = 1; ; width *= 2) {
+    auto lhs = list;
+    auto tail = head;
+    list = head;
+    std::size_t merges = 0;
+    while (lhs != head) {
+      ++merges;
+      auto rhs = lhs;
+      std::size_t lhs_size = 0;
+      for (; lhs_size < width && rhs != head; ++lhs_size) {
+        rhs = links[rhs].next;
+      }
+      auto rhs_size = width;
+      while (lhs_size > 0 || (rhs_size > 0 && rhs != head)) {
+        Index ix;
+        if (lhs_size != 0 && (rhs_size == 0 || rhs == head || !less(rhs, lhs))) {
+          ix = lhs;
+          lhs = links[lhs].next;
+          --lhs_size;
+        }
+        else {
+          ix = rhs;
+          rhs = links[rhs].next;
+          --rhs_size;
+        }
+        if (tail == head) {
+          list = ix;
+        }
+        else {
+          links[tail].next = ix;
+        }
+        tail = ix;
+      }
+      lhs = rhs;
+    }
+    links[tail].next = head;
+    if (merges <= 1) {
+      break;
+    }
+  }
+  auto prev = head;
+  for (auto ix = list; ix != head; ix = links[ix].next) {
+    links[ix].prev = prev;
+    prev = ix;
+  }
+  links[head].next = list;
+  links[head].prev = prev;
+}
+
+} /* namespace clst::detail */
+
+#endif /* index_links_hpp */
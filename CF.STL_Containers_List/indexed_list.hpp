@@ -0,0 +1,187 @@
+//
+//  indexed_list.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: https://en.cppreference.com/w/cpp/container/list/splice
+//  @see: https://en.cppreference.com/w/cpp/algorithm/find
+//
+
+#ifndef indexed_list_hpp
+#define indexed_list_hpp
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <list>
+#include <tuple>
+#include <utility>
+
+#include "open_hash.hpp"
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst
+namespace clst {
+
+/*
+ *  MARK: indexed_list
+ *  A std::list of key/value pairs with unique keys, plus a hash index from key
+ *  to list iterator.  find() is O(1) on average where std::find on the list is
+ *  O(n); everything a list does cheaply - insert at a known position, erase,
+ *  splice - stays O(1), because list iterators are never invalidated by moving
+ *  nodes and the index holds nothing else.
+ *
+ *  Inserting a key that is already present inserts nothing and returns the
+ *  existing element, as std::unordered_map::insert does.
+ */
+template<typename K, typename V, typename Hash = std::hash<K>, typename Eq = std::equal_to<K>>
+class indexed_list {
+public:
+  using key_type = K;
+  using mapped_type = V;
+  using value_type = std::pair<K const, V>;
+  using size_type = std::size_t;
+  using list_type = std::list<value_type>;
+  using iterator = typename list_type::iterator;
+  using const_iterator = typename list_type::const_iterator;
+
+private:
+  struct key_of {
+    auto operator()(iterator it) const noexcept -> K const & { return it->first; }
+  };
+
+public:
+  indexed_list() = default;
+
+  indexed_list(std::initializer_list<value_type> init) {
+    reserve(init.size());
+    for (auto const & el : init) {
+      push_back(el.first, el.second);
+    }
+  }
+
+  //  The copy gets its own index, over its own nodes.
+  indexed_list(indexed_list const & other) : list_ { other.list_ } { reindex(); }
+
+  auto operator=(indexed_list const & other) -> indexed_list & {
+    //  The keys are const, so a std::list of them can only be copy-assigned by
+    //  building a new one.
+    if (this != &other) {
+      *this = indexed_list(other);
+    }
+    return *this;
+  }
+
+  //  Moving a std::list keeps its nodes, so the index moves with it.
+  indexed_list(indexed_list &&) noexcept = default;
+  auto operator=(indexed_list &&) noexcept -> indexed_list & = default;
+
+  //  MARK: Iterators
+  auto begin() noexcept -> iterator { return list_.begin(); }
+  auto begin() const noexcept -> const_iterator { return list_.begin(); }
+  auto end() noexcept -> iterator { return list_.end(); }
+  auto end() const noexcept -> const_iterator { return list_.end(); }
+
+  //  MARK: Capacity
+  [[nodiscard]] auto empty() const noexcept -> bool { return list_.empty(); }
+  auto size() const noexcept -> size_type { return list_.size(); }
+  auto reserve(size_type count) -> void { index_.reserve(count); }
+
+  //  MARK: Element access
+  auto front() -> value_type & { return list_.front(); }
+  auto front() const -> value_type const & { return list_.front(); }
+  auto back() -> value_type & { return list_.back(); }
+  auto back() const -> value_type const & { return list_.back(); }
+
+  //  MARK: Lookup
+  auto find(K const & key) -> iterator {
+    auto const * at = index_.find(key);
+    return at != nullptr ? *at : list_.end();
+  }
+  auto find(K const & key) const -> const_iterator {
+    auto const * at = index_.find(key);
+    return at != nullptr ? const_iterator(*at) : list_.end();
+  }
+  auto contains(K const & key) const -> bool { return index_.find(key) != nullptr; }
+
+  //  MARK: Modifiers
+  //  Insert key/value before pos, unless key is already present.
+  template<typename... Args>
+  auto emplace(const_iterator pos, K key, Args &&... args) -> std::pair<iterator, bool> {
+    auto const hash = index_.hash_of(key);
+    if (auto const * at = index_.find(key, hash)) {
+      return { *at, false, };
+    }
+    auto it = list_.emplace(pos, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+                            std::forward_as_tuple(std::forward<Args>(args)...));
+    try {
+      index_.insert(it, hash);
+    }
+    catch (...) {
+      list_.erase(it);
+      throw;
+    }
+    return { it, true, };
+  }
+
+  auto insert(const_iterator pos, K key, V value) -> std::pair<iterator, bool> {
+    return emplace(pos, std::move(key), std::move(value));
+  }
+  auto push_front(K key, V value) -> std::pair<iterator, bool> {
+    return emplace(list_.begin(), std::move(key), std::move(value));
+  }
+  auto push_back(K key, V value) -> std::pair<iterator, bool> {
+    return emplace(list_.end(), std::move(key), std::move(value));
+  }
+
+  auto erase(const_iterator pos) -> iterator {
+    index_.erase(pos->first);
+    return list_.erase(pos);
+  }
+
+  //  Returns the number of elements removed, 0 or 1.
+  auto erase(K const & key) -> size_type {
+    auto const * at = index_.find(key);
+    if (at == nullptr) {
+      return 0;
+    }
+    auto const it = *at;
+    index_.erase(key);
+    list_.erase(it);
+    return 1;
+  }
+
+  auto pop_front() -> void { erase(list_.begin()); }
+  auto pop_back() -> void { erase(std::prev(list_.end())); }
+
+  auto clear() noexcept -> void {
+    index_.clear();
+    list_.clear();
+  }
+
+  //  Move the element at 'it' in front of 'pos' without copying it.
+  auto splice(const_iterator pos, const_iterator it) noexcept -> void { list_.splice(pos, list_, it); }
+  auto move_to_front(const_iterator it) noexcept -> void { splice(list_.begin(), it); }
+  auto move_to_back(const_iterator it) noexcept -> void { splice(list_.end(), it); }
+
+  //  The underlying list, for algorithms that only read it.
+  auto list() const noexcept -> list_type const & { return list_; }
+
+private:
+  auto reindex() -> void {
+    index_.clear();
+    index_.reserve(list_.size());
+    for (auto it = list_.begin(); it != list_.end(); ++it) {
+      index_.insert(it);
+    }
+  }
+
+  list_type list_;
+  open_index<iterator, K, key_of, Hash, Eq> index_;
+};
+
+} /* namespace clst */
+
+#endif /* indexed_list_hpp */
@@ -0,0 +1,692 @@
+//
+//  indexed_sequence.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: https://en.wikipedia.org/wiki/Treap
+//  @see: https://en.wikipedia.org/wiki/Order_statistic_tree
+//
+
+#ifndef indexed_sequence_hpp
+#define indexed_sequence_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <iterator>
+#include <algorithm>
+#include <compare>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "synth_three_way.hpp"
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst
+namespace clst {
+
+/*
+ *  MARK: indexed_sequence
+ *  A sequence with the std::list interface whose elements also have indices.
+ *  It is an implicit treap: a binary tree in element order, each node counting
+ *  the nodes below it and carrying a random priority that keeps the tree
+ *  balanced in expectation.  So, for n elements:
+ *  - operator[], nth(), index_of() and jumps of an iterator by any distance
+ *    are O(log n), where std::advance on a std::list is O(distance);
+ *  - insert and erase at an iterator or index are O(log n);
+ *  - splice of a range and split are O(log n), whatever the length of the range;
+ *  - ++ and -- are O(1) amortised, O(log n) at worst.
+ *
+ *  Nodes are never moved or copied by these operations, so iterators and
+ *  references stay valid exactly as they do for std::list, except that end()
+ *  belongs to the container: it does not follow a swap or a move.  The root
+ *  hangs from a header node inside the container, which is end(); an
+ *  iterator finds the tree its node is in now by climbing to the header.
+ */
+template<typename T, typename Allocator = std::allocator<T>>
+class indexed_sequence {
+  struct node;
+
+  //  The links, shared by the nodes and the header.  Only the header has no
+  //  parent; its left is the root.
+  struct node_base {
+    node * left = nullptr;
+    node * right = nullptr;
+    node_base * parent = nullptr;
+    std::size_t size = 1;
+  };
+
+  struct node : node_base {
+    template<typename... Args>
+    explicit node(std::uint32_t prio, Args &&... args) : priority { prio }, value (std::forward<Args>(args)...) {}
+
+    std::uint32_t priority;
+    T value;
+  };
+
+  using node_alloc = typename std::allocator_traits<Allocator>::template rebind_alloc<node>;
+  using node_traits = std::allocator_traits<node_alloc>;
+
+  static auto size_of(node const * nd) noexcept -> std::size_t { return nd == nullptr ? 0 : nd->size; }
+
+  static auto leftmost(node * nd) noexcept -> node * {
+    while (nd != nullptr && nd->left != nullptr) {
+      nd = nd->left;
+    }
+    return nd;
+  }
+
+  static auto rightmost(node * nd) noexcept -> node * {
+    while (nd != nullptr && nd->right != nullptr) {
+      nd = nd->right;
+    }
+    return nd;
+  }
+
+  static auto is_header(node_base const * nd) noexcept -> bool { return nd->parent == nullptr; }
+
+  static auto header_of(node_base * nd) noexcept -> node_base * {
+    while (!is_header(nd)) {
+      nd = nd->parent;
+    }
+    return nd;
+  }
+
+  //  The node at index ix of the tree under header hd; hd when ix is size().
+  static auto node_at(node_base * hd, std::size_t ix) noexcept -> node_base * {
+    auto * nd = hd->left;
+    while (nd != nullptr) {
+      auto const left = size_of(nd->left);
+      if (ix < left) {
+        nd = nd->left;
+      }
+      else if (ix == left) {
+        return nd;
+      }
+      else {
+        ix -= left + 1;
+        nd = nd->right;
+      }
+    }
+    return hd;
+  }
+
+  //  Index of a node in the tree it is in; size() for the header.
+  static auto rank(node_base const * nd) noexcept -> std::size_t {
+    auto ix = size_of(nd->left);
+    if (is_header(nd)) {
+      return ix;
+    }
+    for (; !is_header(nd->parent); nd = nd->parent) {
+      if (nd->parent->right == nd) {
+        ix += size_of(nd->parent->left) + 1;
+      }
+    }
+    return ix;
+  }
+
+  //  MARK: basic_iterator
+  //  Random access: jumps and differences walk the tree in O(log n).
+  template<bool Const>
+  class basic_iterator {
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, T const *, T *>;
+    using reference = std::conditional_t<Const, T const &, T &>;
+
+    basic_iterator() noexcept = default;
+    template<bool C = Const, typename = std::enable_if_t<C>>
+    basic_iterator(basic_iterator<false> const & other) noexcept : nd_ { other.nd_ } {}
+
+    auto operator*() const -> reference { return static_cast<node *>(nd_)->value; }
+    auto operator->() const -> pointer { return &static_cast<node *>(nd_)->value; }
+    auto operator[](difference_type dist) const -> reference { return *(*this + dist); }
+
+    auto operator++() -> basic_iterator & {
+      if (nd_->right != nullptr) {
+        nd_ = leftmost(nd_->right);
+      }
+      else {
+        auto * from = nd_;
+        nd_ = nd_->parent;
+        while (!is_header(nd_) && nd_->right == from) {
+          from = nd_;
+          nd_ = nd_->parent;
+        }
+      }
+      return *this;
+    }
+    auto operator++(int) -> basic_iterator { auto tmp = *this; ++*this; return tmp; }
+
+    auto operator--() -> basic_iterator & {
+      if (is_header(nd_)) {
+        nd_ = rightmost(nd_->left);
+      }
+      else if (nd_->left != nullptr) {
+        nd_ = rightmost(nd_->left);
+      }
+      else {
+        auto * from = nd_;
+        nd_ = nd_->parent;
+        while (nd_->left == from) {
+          from = nd_;
+          nd_ = nd_->parent;
+        }
+      }
+      return *this;
+    }
+    auto operator--(int) -> basic_iterator { auto tmp = *this; --*this; return tmp; }
+
+    auto operator+=(difference_type dist) -> basic_iterator & {
+      nd_ = node_at(header_of(nd_), static_cast<std::size_t>(index() + dist));
+      return *this;
+    }
+    auto operator-=(difference_type dist) -> basic_iterator & { return *this += -dist; }
+
+    friend auto operator+(basic_iterator it, difference_type dist) -> basic_iterator { return it += dist; }
+    friend auto operator+(difference_type dist, basic_iterator it) -> basic_iterator { return it += dist; }
+    friend auto operator-(basic_iterator it, difference_type dist) -> basic_iterator { return it -= dist; }
+    friend auto operator-(basic_iterator const & lhs, basic_iterator const & rhs) -> difference_type {
+      return lhs.index() - rhs.index();
+    }
+
+    friend auto operator==(basic_iterator const & lhs, basic_iterator const & rhs) -> bool {
+      return lhs.nd_ == rhs.nd_;
+    }
+    friend auto operator<=>(basic_iterator const & lhs, basic_iterator const & rhs) -> std::strong_ordering {
+      return lhs.index() <=> rhs.index();
+    }
+
+  private:
+    friend class indexed_sequence;
+    friend class basic_iterator<!Const>;
+
+    explicit basic_iterator(node_base * nd) noexcept : nd_ { nd } {}
+
+    auto index() const noexcept -> difference_type { return static_cast<difference_type>(rank(nd_)); }
+
+    node_base * nd_ = nullptr;  // the header is end()
+  };
+
+public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T &;
+  using const_reference = T const &;
+  using pointer = typename std::allocator_traits<Allocator>::pointer;
+  using const_pointer = typename std::allocator_traits<Allocator>::const_pointer;
+  using iterator = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  //  MARK: construct/copy/destroy
+  indexed_sequence() : indexed_sequence(Allocator()) {}
+  explicit indexed_sequence(Allocator const & alloc) : alloc_ { alloc } {}
+
+  indexed_sequence(size_type count, T const & value, Allocator const & alloc = Allocator())
+    : indexed_sequence(alloc) { insert(end(), count, value); }
+
+  template<typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  indexed_sequence(InputIt first, InputIt last, Allocator const & alloc = Allocator())
+    : indexed_sequence(alloc) { insert(end(), first, last); }
+
+  indexed_sequence(std::initializer_list<T> init, Allocator const & alloc = Allocator())
+    : indexed_sequence(init.begin(), init.end(), alloc) {}
+
+  indexed_sequence(indexed_sequence const & other)
+    : indexed_sequence(other.begin(), other.end(),
+                       std::allocator_traits<Allocator>::select_on_container_copy_construction(other.get_allocator())) {}
+
+  indexed_sequence(indexed_sequence && other) noexcept
+    : alloc_ { std::move(other.alloc_) }, seed_ { other.seed_ } { set_root(other.release()); }
+
+  ~indexed_sequence() { clear(); }
+
+  auto operator=(indexed_sequence const & other) -> indexed_sequence & {
+    if (this != &other) {
+      assign(other.begin(), other.end());
+    }
+    return *this;
+  }
+
+  auto operator=(indexed_sequence && other) noexcept(node_traits::propagate_on_container_move_assignment::value
+                                                     || node_traits::is_always_equal::value) -> indexed_sequence & {
+    if (this == &other) {
+      return *this;
+    }
+    if constexpr (node_traits::propagate_on_container_move_assignment::value) {
+      clear();
+      alloc_ = std::move(other.alloc_);
+      set_root(other.release());
+    }
+    else {
+      if (alloc_ == other.alloc_) {
+        clear();
+        set_root(other.release());
+      }
+      else {
+        assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+        other.clear();
+      }
+    }
+    return *this;
+  }
+
+  auto operator=(std::initializer_list<T> init) -> indexed_sequence & {
+    assign(init.begin(), init.end());
+    return *this;
+  }
+
+  template<typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  auto assign(InputIt first, InputIt last) -> void {
+    clear();
+    insert(end(), first, last);
+  }
+  auto assign(size_type count, T const & value) -> void {
+    clear();
+    insert(end(), count, value);
+  }
+  auto assign(std::initializer_list<T> init) -> void { assign(init.begin(), init.end()); }
+
+  auto get_allocator() const -> allocator_type { return allocator_type(alloc_); }
+
+  //  MARK: Element access
+  auto front() -> reference { return leftmost(root())->value; }
+  auto front() const -> const_reference { return leftmost(root())->value; }
+  auto back() -> reference { return rightmost(root())->value; }
+  auto back() const -> const_reference { return rightmost(root())->value; }
+
+  auto operator[](size_type ix) -> reference { return static_cast<node *>(node_at(header(), ix))->value; }
+  auto operator[](size_type ix) const -> const_reference { return static_cast<node *>(node_at(header(), ix))->value; }
+
+  auto at(size_type ix) -> reference { return (*this)[checked(ix)]; }
+  auto at(size_type ix) const -> const_reference { return (*this)[checked(ix)]; }
+
+  //  MARK: Positions
+  //  Iterator to the element at index ix; end() when ix == size().
+  auto nth(size_type ix) -> iterator { return iterator(node_at(header(), ix)); }
+  auto nth(size_type ix) const -> const_iterator { return const_iterator(node_at(header(), ix)); }
+
+  //  Index of the element at pos; size() for end().
+  auto index_of(const_iterator pos) const noexcept -> size_type { return rank(pos.nd_); }
+
+  //  MARK: Iterators
+  auto begin() noexcept -> iterator { return iterator(first()); }
+  auto begin() const noexcept -> const_iterator { return const_iterator(first()); }
+  auto cbegin() const noexcept -> const_iterator { return begin(); }
+  auto end() noexcept -> iterator { return iterator(header()); }
+  auto end() const noexcept -> const_iterator { return const_iterator(header()); }
+  auto cend() const noexcept -> const_iterator { return end(); }
+  auto rbegin() noexcept -> reverse_iterator { return reverse_iterator(end()); }
+  auto rbegin() const noexcept -> const_reverse_iterator { return const_reverse_iterator(end()); }
+  auto crbegin() const noexcept -> const_reverse_iterator { return rbegin(); }
+  auto rend() noexcept -> reverse_iterator { return reverse_iterator(begin()); }
+  auto rend() const noexcept -> const_reverse_iterator { return const_reverse_iterator(begin()); }
+  auto crend() const noexcept -> const_reverse_iterator { return rend(); }
+
+  //  MARK: Capacity
+  [[nodiscard]] auto empty() const noexcept -> bool { return root() == nullptr; }
+  auto size() const noexcept -> size_type { return size_of(root()); }
+  auto max_size() const noexcept -> size_type { return node_traits::max_size(alloc_); }
+
+  //  MARK: Modifiers
+  auto clear() noexcept -> void {
+    destroy(release());
+  }
+
+  template<typename... Args>
+  auto emplace(const_iterator pos, Args &&... args) -> iterator {
+    auto * nd = make_node(std::forward<Args>(args)...);
+    attach(rank(pos.nd_), nd);
+    return iterator(nd);
+  }
+
+  auto insert(const_iterator pos, T const & value) -> iterator { return emplace(pos, value); }
+  auto insert(const_iterator pos, T && value) -> iterator { return emplace(pos, std::move(value)); }
+
+  auto insert(const_iterator pos, size_type count, T const & value) -> iterator {
+    struct repeat {
+      T const * value;
+      size_type left;
+      auto done() const noexcept -> bool { return left == 0; }
+      auto take() -> T const & { --left; return *value; }
+    };
+    return insert_run(pos, repeat { &value, count, });
+  }
+
+  //  The new elements are built into a tree of their own in O(count), which
+  //  is then joined in at pos in O(log n).
+  template<typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  auto insert(const_iterator pos, InputIt first, InputIt last) -> iterator {
+    struct range {
+      InputIt first;
+      InputIt last;
+      auto done() const -> bool { return first == last; }
+      auto take() -> decltype(auto) { return *first++; }
+    };
+    return insert_run(pos, range { first, last, });
+  }
+
+  auto insert(const_iterator pos, std::initializer_list<T> init) -> iterator {
+    return insert(pos, init.begin(), init.end());
+  }
+
+  auto erase(const_iterator pos) -> iterator {
+    auto * nd = static_cast<node *>(pos.nd_);
+    auto next = std::next(iterator(nd));
+    detach(nd);
+    free_node(nd);
+    return next;
+  }
+
+  auto erase(const_iterator first, const_iterator last) -> iterator {
+    if (first == last) {
+      return iterator(last.nd_);
+    }
+    destroy(cut(rank(first.nd_), rank(last.nd_)));
+    return iterator(last.nd_);
+  }
+
+  auto push_back(T const & value) -> void { emplace(end(), value); }
+  auto push_back(T && value) -> void { emplace(end(), std::move(value)); }
+  template<typename... Args>
+  auto emplace_back(Args &&... args) -> reference { return *emplace(end(), std::forward<Args>(args)...); }
+  auto pop_back() -> void { erase(const_iterator(rightmost(root()))); }
+
+  auto push_front(T const & value) -> void { emplace(begin(), value); }
+  auto push_front(T && value) -> void { emplace(begin(), std::move(value)); }
+  template<typename... Args>
+  auto emplace_front(Args &&... args) -> reference { return *emplace(begin(), std::forward<Args>(args)...); }
+  auto pop_front() -> void { erase(begin()); }
+
+  auto resize(size_type count) -> void { resize(count, T()); }
+  auto resize(size_type count, T const & value) -> void {
+    if (count < size()) {
+      destroy(cut(count, size()));
+    }
+    else {
+      insert(end(), count - size(), value);
+    }
+  }
+
+  auto swap(indexed_sequence & other) noexcept -> void {
+    if constexpr (node_traits::propagate_on_container_swap::value) {
+      using std::swap;
+      swap(alloc_, other.alloc_);
+    }
+    auto * mine = release();
+    set_root(other.release());
+    other.set_root(mine);
+  }
+
+  //  MARK: Operations
+  //  Move elements of other in front of pos without copying them.  As for
+  //  std::list the allocators must compare equal, and when other is *this pos
+  //  must not lie inside the moved range.  O(log n) for any range.
+  auto splice(const_iterator pos, indexed_sequence & other) -> void {
+    splice(pos, other, other.begin(), other.end());
+  }
+  auto splice(const_iterator pos, indexed_sequence && other) -> void { splice(pos, other); }
+
+  auto splice(const_iterator pos, indexed_sequence & other, const_iterator it) -> void {
+    splice(pos, other, it, std::next(it));
+  }
+  auto splice(const_iterator pos, indexed_sequence && other, const_iterator it) -> void { splice(pos, other, it); }
+
+  auto splice(const_iterator pos, indexed_sequence & other, const_iterator first, const_iterator last) -> void {
+    if (first == last || (&other == this && pos == last)) {
+      return;
+    }
+    auto const from = other.rank(first.nd_);
+    auto const to = other.rank(last.nd_);
+    auto at = rank(pos.nd_);
+    auto * run = other.cut(from, to);
+    if (&other == this && at > from) {
+      at -= to - from;
+    }
+    attach(at, run);
+  }
+  auto splice(const_iterator pos, indexed_sequence && other, const_iterator first, const_iterator last) -> void {
+    splice(pos, other, first, last);
+  }
+
+  //  Remove [pos, end()) and return it as a sequence of its own.  O(log n).
+  auto split(const_iterator pos) -> indexed_sequence {
+    indexed_sequence tail(alloc_);
+    tail.set_root(cut(rank(pos.nd_), size()));
+    return tail;
+  }
+
+  //  Move every element of other to the end.  O(log n).
+  auto append(indexed_sequence & other) -> void { splice(end(), other); }
+
+private:
+  //  MARK: tree
+  //  Join two detached trees, every element of lhs before every element of rhs.
+  static auto join(node * lhs, node * rhs) noexcept -> node * {
+    if (lhs == nullptr) {
+      return rhs;
+    }
+    if (rhs == nullptr) {
+      return lhs;
+    }
+    if (lhs->priority > rhs->priority) {
+      lhs->right = join(lhs->right, rhs);
+      lhs->right->parent = lhs;
+      lhs->size = 1 + size_of(lhs->left) + size_of(lhs->right);
+      return lhs;
+    }
+    rhs->left = join(lhs, rhs->left);
+    rhs->left->parent = rhs;
+    rhs->size = 1 + size_of(rhs->left) + size_of(rhs->right);
+    return rhs;
+  }
+
+  //  Split a tree into its first 'count' elements and the rest.  The parent
+  //  pointers of the two roots are left for the caller to reset.
+  static auto split(node * nd, std::size_t count) noexcept -> std::pair<node *, node *> {
+    if (nd == nullptr) {
+      return { nullptr, nullptr, };
+    }
+    if (size_of(nd->left) >= count) {
+      auto const [lhs, rhs] = split(nd->left, count);
+      nd->left = rhs;
+      if (rhs != nullptr) {
+        rhs->parent = nd;
+      }
+      nd->size = 1 + size_of(nd->left) + size_of(nd->right);
+      return { lhs, nd, };
+    }
+    auto const [lhs, rhs] = split(nd->right, count - size_of(nd->left) - 1);
+    nd->right = lhs;
+    if (lhs != nullptr) {
+      lhs->parent = nd;
+    }
+    nd->size = 1 + size_of(nd->left) + size_of(nd->right);
+    return { nd, rhs, };
+  }
+
+  static auto orphan(node * nd) noexcept -> node * {
+    if (nd != nullptr) {
+      nd->parent = nullptr;
+    }
+    return nd;
+  }
+
+  //  Take elements [from, to) out as a detached tree.
+  auto cut(std::size_t from, std::size_t to) noexcept -> node * {
+    auto const [head, rest] = split(release(), from);
+    auto const [mid, tail] = split(orphan(rest), to - from);
+    set_root(join(orphan(head), orphan(tail)));
+    return orphan(mid);
+  }
+
+  //  Put a detached tree in at index ix.
+  auto attach(std::size_t ix, node * run) noexcept -> void {
+    auto const [head, tail] = split(release(), ix);
+    set_root(join(join(orphan(head), run), orphan(tail)));
+  }
+
+  auto root() const noexcept -> node * { return header_.left; }
+
+  auto header() const noexcept -> node_base * { return const_cast<node_base *>(&header_); }
+
+  auto first() const noexcept -> node_base * { return empty() ? header() : leftmost(root()); }
+
+  auto set_root(node * nd) noexcept -> void {
+    header_.left = nd;
+    if (nd != nullptr) {
+      nd->parent = &header_;
+    }
+  }
+
+  //  Take the whole tree out, detached.
+  auto release() noexcept -> node * {
+    return orphan(std::exchange(header_.left, nullptr));
+  }
+
+  //  Unlink one node, putting the join of its subtrees in its place.
+  auto detach(node * nd) noexcept -> void {
+    auto * repl = join(orphan(nd->left), orphan(nd->right));
+    auto * par = nd->parent;
+    if (repl != nullptr) {
+      repl->parent = par;
+    }
+    if (par->left == nd) {
+      par->left = repl;
+    }
+    else {
+      par->right = repl;
+    }
+    for (; !is_header(par); par = par->parent) {
+      --par->size;
+    }
+  }
+
+  auto checked(size_type ix) const -> size_type {
+    if (ix >= size()) {
+      throw std::out_of_range("clst::indexed_sequence::at");
+    }
+    return ix;
+  }
+
+  //  Build the elements a source yields into a detached tree in one pass,
+  //  keeping the right spine on a stack (Cartesian tree construction), then
+  //  join it in at pos.
+  template<typename Source>
+  auto insert_run(const_iterator pos, Source src) -> iterator {
+    auto const at = rank(pos.nd_);
+    std::vector<node *> spine;
+    node * first = nullptr;
+    try {
+      while (!src.done()) {
+        auto * nd = make_node(src.take());
+        node * below = nullptr;
+        while (!spine.empty() && spine.back()->priority < nd->priority) {
+          below = spine.back();
+          spine.pop_back();
+        }
+        nd->left = below;
+        if (below != nullptr) {
+          below->parent = nd;
+        }
+        if (!spine.empty()) {
+          spine.back()->right = nd;
+          nd->parent = spine.back();
+        }
+        spine.push_back(nd);
+        if (first == nullptr) {
+          first = nd;
+        }
+      }
+    }
+    catch (...) {
+      if (!spine.empty()) {
+        destroy(spine.front());
+      }
+      throw;
+    }
+    if (first == nullptr) {
+      return iterator(pos.nd_);
+    }
+    resize_subtree(spine.front());
+    attach(at, spine.front());
+    return iterator(first);
+  }
+
+  static auto resize_subtree(node * nd) noexcept -> std::size_t {
+    if (nd == nullptr) {
+      return 0;
+    }
+    nd->size = 1 + resize_subtree(nd->left) + resize_subtree(nd->right);
+    return nd->size;
+  }
+
+  //  xorshift32: priorities only have to be independent of the element order.
+  auto next_priority() noexcept -> std::uint32_t {
+    seed_ ^= seed_ << 13;
+    seed_ ^= seed_ >> 17;
+    seed_ ^= seed_ << 5;
+    return seed_;
+  }
+
+  template<typename... Args>
+  auto make_node(Args &&... args) -> node * {
+    auto * nd = node_traits::allocate(alloc_, 1);
+    try {
+      node_traits::construct(alloc_, nd, next_priority(), std::forward<Args>(args)...);
+    }
+    catch (...) {
+      node_traits::deallocate(alloc_, nd, 1);
+      throw;
+    }
+    return nd;
+  }
+
+  auto free_node(node * nd) noexcept -> void {
+    node_traits::destroy(alloc_, nd);
+    node_traits::deallocate(alloc_, nd, 1);
+  }
+
+  auto destroy(node * nd) noexcept -> void {
+    while (nd != nullptr) {
+      destroy(nd->left);
+      auto * right = nd->right;
+      free_node(nd);
+      nd = right;
+    }
+  }
+
+  [[no_unique_address]] node_alloc alloc_;
+  node_base header_ {};
+  std::uint32_t seed_ = 2'463'534'242u;
+};
+
+template<typename T, typename A>
+auto operator==(indexed_sequence<T, A> const & lhs, indexed_sequence<T, A> const & rhs) -> bool {
+  return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template<typename T, typename A>
+auto operator<=>(indexed_sequence<T, A> const & lhs, indexed_sequence<T, A> const & rhs) {
+  return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                                                detail::synth_three_way {});
+}
+
+template<typename T, typename A>
+auto swap(indexed_sequence<T, A> & lhs, indexed_sequence<T, A> & rhs) noexcept -> void {
+  lhs.swap(rhs);
+}
+
+} /* namespace clst */
+
+#endif /* indexed_sequence_hpp */
@@ -0,0 +1,434 @@
+//
+//  instrumented_list.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: http://hdrhistogram.org
+//  @see: https://en.cppreference.com/w/cpp/container/list
+//
+
+#ifndef instrumented_list_hpp
+#define instrumented_list_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <deque>
+#include <initializer_list>
+#include <iomanip>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "stopwatch.hpp"
+
+//  Build with -DCLST_INSTRUMENT=1 to time list operations.  Left at 0,
+//  instrumented_list is std::list itself and costs nothing.
+#ifndef CLST_INSTRUMENT
+#define CLST_INSTRUMENT 0
+#endif
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst
+namespace clst {
+
+inline constexpr bool instrumented = CLST_INSTRUMENT != 0;
+
+/*
+ *  MARK: list_op
+ *  The operations instrumented_list times.  push covers push_* and
+ *  emplace*, erase covers pop_*, and remove_if covers remove.
+ */
+enum class list_op : std::size_t { push, insert, erase, splice, merge, sort, remove_if, unique, count_, };
+
+inline constexpr std::array<std::string_view, static_cast<std::size_t>(list_op::count_)> list_op_names {
+  "push", "insert", "erase", "splice", "merge", "sort", "remove_if", "unique",
+};
+
+/*
+ *  MARK: latency_histogram
+ *  HDR-style histogram of durations in nanoseconds: every power of two is
+ *  split into 2^sub_bits equal buckets, so any recorded value is known to
+ *  within 1 / 2^sub_bits (about 3 %) whatever its magnitude.  Buckets are
+ *  added as larger values arrive; a histogram of short operations stays
+ *  a few hundred bytes.
+ */
+class latency_histogram {
+public:
+  static constexpr unsigned sub_bits = 5;
+  static constexpr std::uint64_t sub_count = std::uint64_t { 1 } << sub_bits;
+
+  auto record(std::uint64_t ns) -> void {
+    auto const ix = bucket_of(ns);
+    if (ix >= counts_.size()) {
+      counts_.resize(ix + 1);
+    }
+    ++counts_[ix];
+    min_ = count_ == 0 ? ns : std::min(min_, ns);
+    max_ = std::max(max_, ns);
+    total_ += ns;
+    ++count_;
+  }
+
+  //  Adds other's values, as if each had been recorded here.
+  auto merge(latency_histogram const & other) -> void {
+    if (other.count_ == 0) {
+      return;
+    }
+    if (other.counts_.size() > counts_.size()) {
+      counts_.resize(other.counts_.size());
+    }
+    for (std::size_t ix = 0; ix < other.counts_.size(); ++ix) {
+      counts_[ix] += other.counts_[ix];
+    }
+    min_ = count_ == 0 ? other.min_ : std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+    total_ += other.total_;
+    count_ += other.count_;
+  }
+
+  auto count() const noexcept -> std::uint64_t { return count_; }
+  auto min() const noexcept -> std::uint64_t { return min_; }
+  auto max() const noexcept -> std::uint64_t { return max_; }
+  auto mean() const noexcept -> double {
+    return count_ == 0 ? 0.0 : static_cast<double>(total_) / static_cast<double>(count_);
+  }
+
+  //  The highest value in the bucket holding the q-th quantile, q in [0, 1];
+  //  never more than max().
+  auto percentile(double q) const -> std::uint64_t {
+    if (count_ == 0) {
+      return 0;
+    }
+    auto const rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(q * static_cast<double>(count_))));
+    std::uint64_t seen = 0;
+    for (std::size_t ix = 0; ix < counts_.size(); ++ix) {
+      seen += counts_[ix];
+      if (seen >= rank) {
+        return std::min(highest_in(ix), max_);
+      }
+    }
+    return max_;
+  }
+
+private:
+  static auto bucket_of(std::uint64_t ns) noexcept -> std::size_t {
+    if (ns < sub_count) {
+      return static_cast<std::size_t>(ns);
+    }
+    auto const shift = static_cast<unsigned>(std::bit_width(ns)) - (sub_bits + 1);
+    return static_cast<std::size_t>((shift + 1) * sub_count + ((ns >> shift) - sub_count));
+  }
+
+  static auto highest_in(std::size_t ix) noexcept -> std::uint64_t {
+    if (ix < sub_count) {
+      return ix;
+    }
+    auto const shift = ix / sub_count - 1;
+    auto const top = ix % sub_count + sub_count;
+    return ((top + 1) << shift) - 1;
+  }
+
+  std::vector<std::uint64_t> counts_;
+  std::uint64_t count_ = 0;
+  std::uint64_t min_ = 0;
+  std::uint64_t max_ = 0;
+  std::uint64_t total_ = 0;
+};
+
+/*
+ *  MARK: latency_section
+ *  One histogram per list_op for the operations run inside one named section.
+ */
+struct latency_section {
+  std::string name;
+  std::array<latency_histogram, static_cast<std::size_t>(list_op::count_)> ops {};
+
+  auto operator[](list_op op) -> latency_histogram & { return ops[static_cast<std::size_t>(op)]; }
+};
+
+/*
+ *  MARK: latency
+ *  Registry of sections, organised like clst::tracking: operations are
+ *  charged to the calling thread's current section (set by latency_scope),
+ *  or to "(unscoped)".  One section must not be fed from two threads.
+ */
+class latency {
+public:
+  static auto section(std::string_view name) -> latency_section & {
+    std::lock_guard<std::mutex> lock { registry_mutex() };
+    for (auto & sec : registry()) {
+      if (sec.name == name) {
+        return sec;
+      }
+    }
+    registry().push_back(latency_section { std::string(name), });
+    return registry().back();
+  }
+
+  static auto current() -> latency_section & {
+    if (auto * cur = current_ptr()) {
+      return *cur;
+    }
+    static auto & unscoped = section("(unscoped)");
+    return unscoped;
+  }
+
+  static auto record(list_op op, std::chrono::nanoseconds took) -> void {
+    current()[op].record(static_cast<std::uint64_t>(std::max<std::int64_t>(took.count(), 0)));
+  }
+
+  //  One row per section and operation that ran, in nanoseconds.
+  static auto report(std::ostream & os) -> void {
+    if constexpr (!instrumented) {
+      os << "latency instrumentation is off; build with -DCLST_INSTRUMENT=1\n";
+      return;
+    }
+    std::lock_guard<std::mutex> lock { registry_mutex() };
+    auto const flags = os.flags();
+    auto const precision = os.precision();
+    os << std::left << std::setw(28) << "section" << std::setw(10) << "op" << std::right
+       << std::setw(8) << "count" << std::setw(9) << "min" << std::setw(9) << "mean"
+       << std::setw(9) << "p50" << std::setw(9) << "p99" << std::setw(9) << "p999"
+       << std::setw(9) << "max" << '\n';
+    for (auto const & sec : registry()) {
+      for (std::size_t ix = 0; ix < sec.ops.size(); ++ix) {
+        auto const & hist = sec.ops[ix];
+        if (hist.count() == 0) {
+          continue;
+        }
+        os << std::left << std::setw(28) << sec.name << std::setw(10) << list_op_names[ix] << std::right
+           << std::setw(8) << hist.count() << std::setw(9) << hist.min()
+           << std::fixed << std::setprecision(0) << std::setw(9) << hist.mean()
+           << std::setw(9) << hist.percentile(0.50) << std::setw(9) << hist.percentile(0.99)
+           << std::setw(9) << hist.percentile(0.999) << std::setw(9) << hist.max() << '\n';
+      }
+    }
+    os.flags(flags);
+    os.precision(precision);
+  }
+
+  //  The same figures as one JSON document.
+  static auto write_json(std::ostream & os) -> void {
+    std::lock_guard<std::mutex> lock { registry_mutex() };
+    os << "{\n  \"instrumented\": " << (instrumented ? "true" : "false") << ",\n  \"unit\": \"ns\",\n"
+       << "  \"sections\": [";
+    char const * sec_sep = "\n";
+    for (auto const & sec : registry()) {
+      os << sec_sep << "    { \"name\": ";
+      write_string(os, sec.name);
+      os << ", \"ops\": {";
+      char const * op_sep = "\n";
+      for (std::size_t ix = 0; ix < sec.ops.size(); ++ix) {
+        auto const & hist = sec.ops[ix];
+        if (hist.count() == 0) {
+          continue;
+        }
+        os << op_sep << "      \"" << list_op_names[ix] << "\": { \"count\": " << hist.count()
+           << ", \"min\": " << hist.min() << ", \"mean\": " << hist.mean()
+           << ", \"p50\": " << hist.percentile(0.50) << ", \"p99\": " << hist.percentile(0.99)
+           << ", \"p999\": " << hist.percentile(0.999) << ", \"max\": " << hist.max() << " }";
+        op_sep = ",\n";
+      }
+      os << (*op_sep == ',' ? "\n    } }" : "} }");
+      sec_sep = ",\n";
+    }
+    os << (*sec_sep == ',' ? "\n  ]\n}\n" : "]\n}\n");
+  }
+
+private:
+  friend class latency_scope;
+
+  static auto write_string(std::ostream & os, std::string_view str) -> void {
+    os << '"';
+    for (auto ch : str) {
+      if (ch == '"' || ch == '\\') {
+        os << '\\' << ch;
+      }
+      else if (static_cast<unsigned char>(ch) < 0x20) {
+        os << ' ';
+      }
+      else {
+        os << ch;
+      }
+    }
+    os << '"';
+  }
+
+  static auto registry() -> std::deque<latency_section> & {
+    static std::deque<latency_section> sections;
+    return sections;
+  }
+
+  static auto registry_mutex() -> std::mutex & {
+    static std::mutex mtx;
+    return mtx;
+  }
+
+  static auto current_ptr() -> latency_section *& {
+    thread_local latency_section * cur = nullptr;
+    return cur;
+  }
+};
+
+/*
+ *  MARK: latency_scope
+ *  Charges timed operations on this thread to the named section until
+ *  destroyed.  Scopes nest; re-entering a name adds to the existing row.
+ */
+class latency_scope {
+public:
+  explicit latency_scope(std::string_view name) : prev_ { latency::current_ptr() } {
+    if constexpr (instrumented) {
+      latency::current_ptr() = &latency::section(name);
+    }
+  }
+
+  latency_scope(latency_scope const &) = delete;
+  latency_scope & operator=(latency_scope const &) = delete;
+
+  ~latency_scope() { latency::current_ptr() = prev_; }
+
+private:
+  latency_section * prev_;
+};
+
+namespace detail {
+
+//  Records the time from construction to destruction against op.
+class latency_timer {
+public:
+  explicit latency_timer(list_op op) noexcept : op_ { op } {}
+  latency_timer(latency_timer const &) = delete;
+  latency_timer & operator=(latency_timer const &) = delete;
+  ~latency_timer() { latency::record(op_, std::chrono::duration_cast<std::chrono::nanoseconds>(sw_.elapsed())); }
+
+private:
+  list_op op_;
+  stopwatch sw_ {};
+};
+
+} /* namespace detail */
+
+#if CLST_INSTRUMENT
+
+/*
+ *  MARK: instrumented_list
+ *  std::list whose mutating operations are timed into the current
+ *  latency_section.  It is a std::list - it converts to one, prints as one
+ *  and has the same iterators - with the timed members hidden and wrapped.
+ */
+template<typename T, typename Allocator = std::allocator<T>>
+class instrumented_list : public std::list<T, Allocator> {
+  using base = std::list<T, Allocator>;
+  using timer = detail::latency_timer;
+
+public:
+  using typename base::value_type;
+  using typename base::size_type;
+  using typename base::iterator;
+  using typename base::const_iterator;
+
+  using base::base;
+  instrumented_list() = default;
+
+  instrumented_list & operator=(std::initializer_list<T> init) {
+    base::operator=(init);
+    return *this;
+  }
+
+  //  push
+  auto push_back(T const & value) -> void { timer tm { list_op::push }; base::push_back(value); }
+  auto push_back(T && value) -> void { timer tm { list_op::push }; base::push_back(std::move(value)); }
+  auto push_front(T const & value) -> void { timer tm { list_op::push }; base::push_front(value); }
+  auto push_front(T && value) -> void { timer tm { list_op::push }; base::push_front(std::move(value)); }
+
+  template<typename... Args>
+  auto emplace_back(Args &&... args) -> typename base::reference {
+    timer tm { list_op::push };
+    return base::emplace_back(std::forward<Args>(args)...);
+  }
+  template<typename... Args>
+  auto emplace_front(Args &&... args) -> typename base::reference {
+    timer tm { list_op::push };
+    return base::emplace_front(std::forward<Args>(args)...);
+  }
+  template<typename... Args>
+  auto emplace(const_iterator pos, Args &&... args) -> iterator {
+    timer tm { list_op::push };
+    return base::emplace(pos, std::forward<Args>(args)...);
+  }
+
+  //  insert
+  template<typename... Args>
+  auto insert(const_iterator pos, Args &&... args) -> iterator {
+    timer tm { list_op::insert };
+    return base::insert(pos, std::forward<Args>(args)...);
+  }
+  auto insert(const_iterator pos, std::initializer_list<T> init) -> iterator {
+    timer tm { list_op::insert };
+    return base::insert(pos, init);
+  }
+
+  //  erase
+  auto erase(const_iterator pos) -> iterator { timer tm { list_op::erase }; return base::erase(pos); }
+  auto erase(const_iterator first, const_iterator last) -> iterator {
+    timer tm { list_op::erase };
+    return base::erase(first, last);
+  }
+  auto pop_back() -> void { timer tm { list_op::erase }; base::pop_back(); }
+  auto pop_front() -> void { timer tm { list_op::erase }; base::pop_front(); }
+
+  //  splice, merge, sort, remove_if, unique
+  template<typename... Args>
+  auto splice(const_iterator pos, Args &&... args) -> void {
+    timer tm { list_op::splice };
+    base::splice(pos, std::forward<Args>(args)...);
+  }
+
+  template<typename... Args>
+  auto merge(Args &&... args) -> void {
+    timer tm { list_op::merge };
+    base::merge(std::forward<Args>(args)...);
+  }
+
+  template<typename... Args>
+  auto sort(Args &&... args) -> void {
+    timer tm { list_op::sort };
+    base::sort(std::forward<Args>(args)...);
+  }
+
+  auto remove(T const & value) -> size_type { timer tm { list_op::remove_if }; return base::remove(value); }
+  template<typename Pred>
+  auto remove_if(Pred pred) -> size_type {
+    timer tm { list_op::remove_if };
+    return base::remove_if(std::move(pred));
+  }
+
+  template<typename... Args>
+  auto unique(Args &&... args) -> size_type {
+    timer tm { list_op::unique };
+    return base::unique(std::forward<Args>(args)...);
+  }
+};
+
+#else
+
+template<typename T, typename Allocator = std::allocator<T>>
+using instrumented_list = std::list<T, Allocator>;
+
+#endif  /* CLST_INSTRUMENT */
+
+} /* namespace clst */
+
+#endif /* instrumented_list_hpp */
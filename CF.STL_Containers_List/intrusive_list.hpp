@@ -0,0 +1,397 @@
+//
+//  intrusive_list.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: https://www.boost.org/doc/libs/release/doc/html/intrusive/list.html
+//  @see: https://en.cppreference.com/w/cpp/container/list
+//
+
+#ifndef intrusive_list_hpp
+#define intrusive_list_hpp
+
+#include <cstddef>
+#include <cassert>
+#include <iterator>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst
+namespace clst {
+
+/*
+ *  MARK: list_hook
+ *  The links an object embeds once for every intrusive_list it can belong to.
+ *  Copying an object does not copy its memberships: a copied hook is unlinked
+ *  and assigning to a hook leaves it as it was.
+ */
+class list_hook {
+public:
+  list_hook() noexcept = default;
+  list_hook(list_hook const &) noexcept {}
+  list_hook & operator=(list_hook const &) noexcept { return *this; }
+
+  //  An object must leave its lists before it is destroyed.
+  ~list_hook() { assert(!is_linked() && "object destroyed while still in an intrusive_list"); }
+
+  auto is_linked() const noexcept -> bool { return next_ != nullptr; }
+
+private:
+  template<typename T, list_hook T::* Hook>
+  friend class intrusive_list;
+
+  list_hook * prev_ = nullptr;
+  list_hook * next_ = nullptr;
+};
+
+/*
+ *  MARK: intrusive_list
+ *  std::list interface over objects that already exist.  The list links the
+ *  objects' own hooks instead of allocating nodes, so it never allocates,
+ *  copies or moves an element, and an object can be in as many lists as it
+ *  has hooks.  The objects must outlive their membership.
+ *
+ *  Besides the usual operations, iterator_to and unlink find an object's
+ *  position from a reference in O(1).  splice of a whole list is O(1); sort
+ *  and merge relink hooks and are stable.
+ */
+template<typename T, list_hook T::* Hook>
+class intrusive_list {
+  //  Where the hook sits inside T, to get from a hook back to its object.
+  //  It is measured on the first real object whose hook is asked for, which
+  //  is always before any hook is followed back: that works for any T, where
+  //  offsetof is limited to standard-layout classes.
+  static auto hook_offset(T const * obj = nullptr) noexcept -> std::ptrdiff_t {
+    static std::ptrdiff_t const offset
+        = reinterpret_cast<std::byte const *>(&(obj->*Hook)) - reinterpret_cast<std::byte const *>(obj);
+    return offset;
+  }
+
+  static auto owner(list_hook * hk) noexcept -> T * {
+    return reinterpret_cast<T *>(reinterpret_cast<std::byte *>(hk) - hook_offset());
+  }
+
+  static auto hook_of(T & obj) noexcept -> list_hook * {
+    hook_offset(&obj);
+    return &(obj.*Hook);
+  }
+
+  template<bool Const>
+  class basic_iterator {
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, T const *, T *>;
+    using reference = std::conditional_t<Const, T const &, T &>;
+
+    basic_iterator() = default;
+    template<bool C = Const, typename = std::enable_if_t<C>>
+    basic_iterator(basic_iterator<false> const & other) noexcept : hk_ { other.hk_ } {}
+
+    auto operator*() const -> reference { return *owner(hk_); }
+    auto operator->() const -> pointer { return owner(hk_); }
+
+    auto operator++() -> basic_iterator & { hk_ = hk_->next_; return *this; }
+    auto operator++(int) -> basic_iterator { auto tmp = *this; ++*this; return tmp; }
+    auto operator--() -> basic_iterator & { hk_ = hk_->prev_; return *this; }
+    auto operator--(int) -> basic_iterator { auto tmp = *this; --*this; return tmp; }
+
+    friend auto operator==(basic_iterator const & lhs, basic_iterator const & rhs) -> bool {
+      return lhs.hk_ == rhs.hk_;
+    }
+
+  private:
+    friend class intrusive_list;
+    friend class basic_iterator<!Const>;
+
+    explicit basic_iterator(list_hook const * hk) noexcept : hk_ { const_cast<list_hook *>(hk) } {}
+
+    list_hook * hk_ = nullptr;
+  };
+
+public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T &;
+  using const_reference = T const &;
+  using iterator = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  //  MARK: construct/destroy
+  intrusive_list() noexcept { reset(); }
+
+  template<typename InputIt>
+  intrusive_list(InputIt first, InputIt last) : intrusive_list() {
+    for (; first != last; ++first) {
+      push_back(*first);
+    }
+  }
+
+  intrusive_list(intrusive_list const &) = delete;
+  intrusive_list & operator=(intrusive_list const &) = delete;
+
+  intrusive_list(intrusive_list && other) noexcept : intrusive_list() { splice(end(), other); }
+
+  auto operator=(intrusive_list && other) noexcept -> intrusive_list & {
+    if (this != &other) {
+      clear();
+      splice(end(), other);
+    }
+    return *this;
+  }
+
+  //  Unlinks every member; the objects themselves are untouched.
+  ~intrusive_list() {
+    clear();
+    head_.prev_ = head_.next_ = nullptr;
+  }
+
+  //  MARK: element access
+  auto front() -> T & { return *owner(head_.next_); }
+  auto front() const -> T const & { return *owner(head_.next_); }
+  auto back() -> T & { return *owner(head_.prev_); }
+  auto back() const -> T const & { return *owner(head_.prev_); }
+
+  //  MARK: iterators
+  auto begin() noexcept -> iterator { return iterator(head_.next_); }
+  auto begin() const noexcept -> const_iterator { return const_iterator(head_.next_); }
+  auto cbegin() const noexcept -> const_iterator { return begin(); }
+  auto end() noexcept -> iterator { return iterator(&head_); }
+  auto end() const noexcept -> const_iterator { return const_iterator(&head_); }
+  auto cend() const noexcept -> const_iterator { return end(); }
+  auto rbegin() noexcept -> reverse_iterator { return reverse_iterator(end()); }
+  auto rbegin() const noexcept -> const_reverse_iterator { return const_reverse_iterator(end()); }
+  auto rend() noexcept -> reverse_iterator { return reverse_iterator(begin()); }
+  auto rend() const noexcept -> const_reverse_iterator { return const_reverse_iterator(begin()); }
+
+  //  Position of an object known to be in this list, in O(1).
+  auto iterator_to(T & obj) noexcept -> iterator { return iterator(hook_of(obj)); }
+  auto iterator_to(T const & obj) const noexcept -> const_iterator {
+    return const_iterator(hook_of(const_cast<T &>(obj)));
+  }
+
+  //  MARK: capacity
+  [[nodiscard]] auto empty() const noexcept -> bool { return size_ == 0; }
+  auto size() const noexcept -> size_type { return size_; }
+
+  //  MARK: modifiers
+  auto clear() noexcept -> void {
+    auto * hk = head_.next_;
+    while (hk != &head_) {
+      auto * nx = hk->next_;
+      hk->prev_ = hk->next_ = nullptr;
+      hk = nx;
+    }
+    reset();
+  }
+
+  //  Link obj before pos.  obj must not already be in a list through this hook.
+  auto insert(const_iterator pos, T & obj) noexcept -> iterator {
+    auto * hk = hook_of(obj);
+    assert(!hk->is_linked() && "object is already in a list through this hook");
+    link_before(pos.hk_, hk);
+    ++size_;
+    return iterator(hk);
+  }
+
+  auto push_back(T & obj) noexcept -> void { insert(end(), obj); }
+  auto push_front(T & obj) noexcept -> void { insert(begin(), obj); }
+
+  auto erase(const_iterator pos) noexcept -> iterator {
+    auto * nx = pos.hk_->next_;
+    unlink_hook(pos.hk_);
+    --size_;
+    return iterator(nx);
+  }
+
+  auto erase(const_iterator first, const_iterator last) noexcept -> iterator {
+    while (first != last) {
+      first = erase(first);
+    }
+    return iterator(last.hk_);
+  }
+
+  //  Take obj out of this list, given only the object, in O(1).
+  auto unlink(T & obj) noexcept -> void { erase(iterator_to(obj)); }
+
+  auto pop_front() noexcept -> void { erase(begin()); }
+  auto pop_back() noexcept -> void { erase(iterator(head_.prev_)); }
+
+  auto swap(intrusive_list & other) noexcept -> void {
+    intrusive_list tmp { std::move(other) };
+    other.splice(other.end(), *this);
+    splice(end(), tmp);
+  }
+
+  //  MARK: operations
+  //  Move all of other's members before pos in O(1).
+  auto splice(const_iterator pos, intrusive_list & other) noexcept -> void {
+    if (other.empty() || &other == this) {
+      return;
+    }
+    transfer(pos.hk_, other.head_.next_, &other.head_);
+    size_ += other.size_;
+    other.reset();
+  }
+
+  auto splice(const_iterator pos, intrusive_list && other) noexcept -> void { splice(pos, other); }
+
+  auto splice(const_iterator pos, intrusive_list & other, const_iterator it) noexcept -> void {
+    if (pos.hk_ == it.hk_ || pos.hk_ == it.hk_->next_) {
+      return;
+    }
+    transfer(pos.hk_, it.hk_, it.hk_->next_);
+    --other.size_;
+    ++size_;
+  }
+
+  //  O(1) within one list; between lists the members of the range are counted.
+  auto splice(const_iterator pos, intrusive_list & other, const_iterator first, const_iterator last) noexcept -> void {
+    if (first == last) {
+      return;
+    }
+    if (&other != this) {
+      auto const count = static_cast<size_type>(std::distance(first, last));
+      other.size_ -= count;
+      size_ += count;
+    }
+    transfer(pos.hk_, first.hk_, last.hk_);
+  }
+
+  auto merge(intrusive_list & other) -> void { merge(other, std::less<>()); }
+
+  //  Both lists sorted by comp; other's members go after equal members of *this.
+  //  If comp throws, the members moved so far stay here and both sizes agree.
+  template<typename Compare>
+  auto merge(intrusive_list & other, Compare comp) -> void {
+    if (&other == this) {
+      return;
+    }
+    auto * hk = head_.next_;
+    auto * ot = other.head_.next_;
+    size_type moved = 0;
+    try {
+      while (hk != &head_ && ot != &other.head_) {
+        if (comp(*owner(ot), *owner(hk))) {
+          auto * run = ot->next_;
+          size_type count = 1;
+          while (run != &other.head_ && comp(*owner(run), *owner(hk))) {
+            run = run->next_;
+            ++count;
+          }
+          transfer(hk, ot, run);
+          moved += count;
+          ot = run;
+        }
+        else {
+          hk = hk->next_;
+        }
+      }
+    }
+    catch (...) {
+      size_ += moved;
+      other.size_ -= moved;
+      throw;
+    }
+    if (ot != &other.head_) {
+      transfer(&head_, ot, &other.head_);
+    }
+    size_ += other.size_;
+    other.reset();
+  }
+
+  auto sort() -> void { sort(std::less<>()); }
+
+  //  Stable merge sort by relinking; recursion depth is log2(size()).
+  //  If comp throws, every member is still linked here, in unspecified order.
+  template<typename Compare>
+  auto sort(Compare comp) -> void {
+    if (size_ < 2) {
+      return;
+    }
+    intrusive_list upper;
+    auto const half = size_ / 2;
+    auto mid = std::next(begin(), static_cast<difference_type>(half));
+    upper.transfer(&upper.head_, mid.hk_, &head_);
+    upper.size_ = size_ - half;
+    size_ = half;
+    try {
+      sort(comp);
+      upper.sort(comp);
+      merge(upper, comp);
+    }
+    catch (...) {
+      splice(end(), upper);
+      throw;
+    }
+  }
+
+  auto reverse() noexcept -> void {
+    auto * hk = &head_;
+    do {
+      std::swap(hk->prev_, hk->next_);
+      hk = hk->prev_;
+    } while (hk != &head_);
+  }
+
+  //  Unlink the members for which pred holds; returns how many were unlinked.
+  template<typename Pred>
+  auto remove_if(Pred pred) -> size_type {
+    auto const before = size_;
+    for (auto it = begin(); it != end(); ) {
+      it = pred(*it) ? erase(it) : std::next(it);
+    }
+    return before - size_;
+  }
+
+  auto remove(T const & value) -> size_type {
+    return remove_if([&value](T const & obj) { return obj == value; });
+  }
+
+private:
+  auto reset() noexcept -> void {
+    head_.prev_ = head_.next_ = &head_;
+    size_ = 0;
+  }
+
+  static auto link_before(list_hook * at, list_hook * hk) noexcept -> void {
+    hk->next_ = at;
+    hk->prev_ = at->prev_;
+    at->prev_->next_ = hk;
+    at->prev_ = hk;
+  }
+
+  static auto unlink_hook(list_hook * hk) noexcept -> void {
+    hk->prev_->next_ = hk->next_;
+    hk->next_->prev_ = hk->prev_;
+    hk->prev_ = hk->next_ = nullptr;
+  }
+
+  //  Move [first, last) before pos; counts are the caller's business.
+  static auto transfer(list_hook * pos, list_hook * first, list_hook * last) noexcept -> void {
+    if (pos == last) {
+      return;
+    }
+    auto * tail = last->prev_;
+    first->prev_->next_ = last;
+    last->prev_ = first->prev_;
+    tail->next_ = pos;
+    first->prev_ = pos->prev_;
+    pos->prev_->next_ = first;
+    pos->prev_ = tail;
+  }
+
+  list_hook head_;
+  size_type size_ = 0;
+};
+
+} /* namespace clst */
+
+#endif /* intrusive_list_hpp */
@@ -0,0 +1,191 @@
+//
+//  list_format.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: https://en.cppreference.com/w/cpp/utility/to_chars
+//  @see: https://en.cppreference.com/w/cpp/io/basic_ostream/write
+//
+
+#ifndef list_format_hpp
+#define list_format_hpp
+
+#include <cstddef>
+#include <charconv>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <version>
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst
+namespace clst {
+
+/*
+ *  MARK: print_list()
+ *  The classic formatter: "[a, b, c]" through the stream, one element at a time.
+ */
+template<typename Container>
+std::ostream & print_list(std::ostream & os, const Container & container) {
+  os.put('[');
+  char comma[3] = { '\0', ' ', '\0', };
+  for (auto const & el : container) {
+    os << comma << el;
+    comma[0] = ',';
+  }
+  return os << ']';
+}
+
+/*
+ *  MARK: list_writer
+ *  Formats into a buffer and hands it to the stream in large blocks.
+ *
+ *  Arithmetic values go through std::to_chars (floating point honours the
+ *  stream's precision, as "%g" does), characters and strings are copied
+ *  verbatim and anything else falls back to the stream's operator<<.
+ *  Floating point also uses operator<< where the library lacks floating-point
+ *  to_chars (__cpp_lib_to_chars unset, e.g. libc++ before macOS 13.3).  Other
+ *  stream flags (width, fixed, showpos, ...) are not applied; boolalpha is.
+ *  The output of write() is the same "[a, b, c]" that print_list produces.
+ */
+class list_writer {
+public:
+  static constexpr std::size_t default_block = 64 * 1024;
+
+  explicit list_writer(std::ostream & os, std::size_t block = default_block)
+    : os_ { os }, buf_ { own_ }, block_ { block } { buf_.reserve(block_); }
+
+  //  Use caller-provided storage, so a long-lived buffer can be reused.
+  list_writer(std::ostream & os, std::string & scratch, std::size_t block = default_block)
+    : os_ { os }, buf_ { scratch }, block_ { block } {
+    buf_.clear();
+    buf_.reserve(block_);
+  }
+
+  list_writer(list_writer const &) = delete;
+  list_writer & operator=(list_writer const &) = delete;
+
+  ~list_writer() { flush(); }
+
+  template<typename Container>
+  auto write(Container const & container) -> list_writer & {
+    put('[');
+    auto first = true;
+    for (auto const & el : container) {
+      if (!first) {
+        put(std::string_view { ", " });
+      }
+      put(el);
+      first = false;
+    }
+    return put(']');
+  }
+
+  auto put(char ch) -> list_writer & {
+    buf_.push_back(ch);
+    spill();
+    return *this;
+  }
+
+  auto put(std::string_view str) -> list_writer & {
+    buf_.append(str);
+    spill();
+    return *this;
+  }
+
+  auto put(std::string const & str) -> list_writer & { return put(std::string_view(str)); }
+  auto put(char const * str) -> list_writer & { return put(std::string_view(str)); }
+
+  template<typename T>
+  auto put(T const & val) -> list_writer & {
+    if constexpr (std::is_same_v<T, bool>) {
+      if (os_.flags() & std::ios_base::boolalpha) {
+        return put(val ? std::string_view { "true" } : std::string_view { "false" });
+      }
+      return put(val ? '1' : '0');
+    }
+    else if constexpr (std::is_same_v<T, signed char> || std::is_same_v<T, unsigned char>) {
+      return put(static_cast<char>(val));
+    }
+    else if constexpr (std::is_integral_v<T>) {
+      return put_chars([&](char * first, char * last) { return std::to_chars(first, last, val); });
+    }
+    else if constexpr (std::is_floating_point_v<T>) {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+      auto const precision = static_cast<int>(os_.precision());
+      return put_chars([&](char * first, char * last) {
+        return std::to_chars(first, last, val, std::chars_format::general, precision == 0 ? 1 : precision);
+      });
+#else
+      flush();
+      os_ << val;
+      return *this;
+#endif
+    }
+    else {
+      flush();
+      os_ << val;
+      return *this;
+    }
+  }
+
+  auto flush() -> void {
+    if (!buf_.empty()) {
+      os_.write(buf_.data(), static_cast<std::streamsize>(buf_.size()));
+      buf_.clear();
+    }
+  }
+
+private:
+  //  Large enough for any integer and for a float printed with %g at the
+  //  precisions a stream is realistically given.
+  static constexpr std::size_t max_number = 128;
+
+  template<typename Conv>
+  auto put_chars(Conv conv) -> list_writer & {
+    auto const used = buf_.size();
+    buf_.resize(used + max_number);
+    auto const res = conv(buf_.data() + used, buf_.data() + buf_.size());
+    buf_.resize(res.ec == std::errc() ? static_cast<std::size_t>(res.ptr - buf_.data()) : used);
+    spill();
+    return *this;
+  }
+
+  auto spill() -> void {
+    if (buf_.size() >= block_) {
+      flush();
+    }
+  }
+
+  std::ostream & os_;
+  std::string own_;
+  std::string & buf_;
+  std::size_t block_;
+};
+
+/*
+ *  MARK: fast()
+ *  Opt-in fast path for insertion: 'os << clst::fast(lst)' prints what
+ *  'os << lst' prints, through a list_writer with a per-thread buffer.
+ */
+template<typename Container>
+struct fast_list {
+  Container const & container;
+
+  friend std::ostream & operator<<(std::ostream & os, fast_list const & fl) {
+    thread_local std::string scratch;
+    list_writer { os, scratch }.write(fl.container);
+    return os;
+  }
+};
+
+template<typename Container>
+auto fast(Container const & container) -> fast_list<Container> {
+  return fast_list<Container> { container, };
+}
+
+} /* namespace clst */
+
+#endif /* list_format_hpp */
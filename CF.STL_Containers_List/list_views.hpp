@@ -0,0 +1,281 @@
+//
+//  list_views.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: https://en.cppreference.com/w/cpp/ranges
+//  @see: https://en.cppreference.com/w/cpp/ranges/to
+//
+
+#ifndef list_views_hpp
+#define list_views_hpp
+
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "bulk_insert.hpp"
+#include "generator.hpp"
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst::views
+namespace clst::views {
+
+/*
+ *  MARK: views
+ *  Lazy pipelines over lists and the other clst containers, or a generator:
+ *
+ *    auto out = words | views::filter(long_word) | views::transform(lower)
+ *                     | views::dedup_adjacent | clst::to<std::list<std::string>>();
+ *
+ *  Each element passes through every stage before the next one is read, so
+ *  the pipeline makes one pass over the source and nothing in between is
+ *  stored; only clst::to builds a container.  filter, transform and take are
+ *  the std::views adaptors; dedup_adjacent is what std::list::unique does,
+ *  as a view.  sort has no lazy form and stays a member of the result.
+ */
+using std::views::filter;
+using std::views::transform;
+using std::views::take;
+
+namespace detail {
+
+//  A function object held by value in a view, which must be assignable even
+//  when a capturing lambda is not.
+template<typename Fn>
+class fn_box {
+public:
+  fn_box() = default;
+  explicit fn_box(Fn fn) : fn_ { std::in_place, std::move(fn) } {}
+
+  fn_box(fn_box const &) = default;
+  fn_box(fn_box &&) = default;
+  fn_box & operator=(fn_box const & other) {
+    if (this != &other) {
+      assign(other.fn_);
+    }
+    return *this;
+  }
+  fn_box & operator=(fn_box && other) noexcept(std::is_nothrow_move_constructible_v<Fn>) {
+    if (this != &other) {
+      assign(std::move(other.fn_));
+    }
+    return *this;
+  }
+
+  auto operator*() const noexcept -> Fn const & { return *fn_; }
+
+private:
+  template<typename Opt>
+  auto assign(Opt && src) -> void {
+    fn_.reset();
+    if (src) {
+      fn_.emplace(*std::forward<Opt>(src));
+    }
+  }
+
+  std::optional<Fn> fn_;
+};
+
+} /* namespace detail */
+
+/*
+ *  MARK: dedup_adjacent_view
+ *  Every run of elements equal to its first is shown as that first element.
+ *  Over a forward range the run is skipped by comparing with the iterator
+ *  left behind; a single-pass source (a generator) cannot be read twice, so
+ *  there the view keeps a copy of the last element it showed.
+ */
+template<std::ranges::input_range V, typename Eq = std::equal_to<>>
+  requires std::ranges::view<V>
+        && std::indirect_binary_predicate<Eq const, std::ranges::iterator_t<V>, std::ranges::iterator_t<V>>
+class dedup_adjacent_view : public std::ranges::view_interface<dedup_adjacent_view<V, Eq>> {
+  using base_iterator = std::ranges::iterator_t<V>;
+  static constexpr bool multipass = std::ranges::forward_range<V>;
+
+public:
+  class iterator;
+
+  class sentinel {
+  public:
+    sentinel() = default;
+    explicit sentinel(std::ranges::sentinel_t<V> end) : end_ { end } {}
+
+    auto base() const -> std::ranges::sentinel_t<V> { return end_; }
+
+  private:
+    std::ranges::sentinel_t<V> end_ {};
+  };
+
+  class iterator {
+  public:
+    using value_type = std::ranges::range_value_t<V>;
+    using difference_type = std::ranges::range_difference_t<V>;
+    using iterator_concept = std::conditional_t<multipass, std::forward_iterator_tag, std::input_iterator_tag>;
+
+    iterator() = default;
+    iterator(dedup_adjacent_view & parent, base_iterator cur) : parent_ { &parent }, cur_ { std::move(cur) } {}
+
+    auto operator*() const -> std::ranges::range_reference_t<V> { return *cur_; }
+
+    auto operator++() -> iterator & {
+      parent_->skip_run(cur_);
+      return *this;
+    }
+    auto operator++(int) {
+      if constexpr (multipass) {
+        auto was = *this;
+        ++*this;
+        return was;
+      }
+      else {
+        ++*this;
+      }
+    }
+
+    friend auto operator==(iterator const & lhs, iterator const & rhs) -> bool
+      requires multipass
+    {
+      return lhs.cur_ == rhs.cur_;
+    }
+    friend auto operator==(iterator const & it, sentinel const & sn) -> bool { return it.cur_ == sn.base(); }
+
+  private:
+    dedup_adjacent_view * parent_ = nullptr;
+    base_iterator cur_ {};
+  };
+
+  dedup_adjacent_view() = default;
+  dedup_adjacent_view(V base, Eq eq) : base_ { std::move(base) }, eq_ { std::move(eq) } {}
+
+  auto base() const & -> V requires std::copy_constructible<V> { return base_; }
+  auto base() && -> V { return std::move(base_); }
+
+  auto begin() -> iterator { return iterator { *this, std::ranges::begin(base_) }; }
+  auto end() -> sentinel { return sentinel { std::ranges::end(base_) }; }
+
+private:
+  friend class iterator;
+
+  //  Moves cur past the run of elements equal to *cur.
+  auto skip_run(base_iterator & cur) -> void {
+    auto const last = std::ranges::end(base_);
+    if constexpr (multipass) {
+      auto const head = cur;
+      while (++cur != last && std::invoke(*eq_, *head, *cur)) {
+      }
+    }
+    else {
+      shown_.emplace(*cur);
+      while (++cur != last && std::invoke(*eq_, *shown_, *cur)) {
+      }
+    }
+  }
+
+  V base_ {};
+  detail::fn_box<Eq> eq_ {};
+  [[no_unique_address]] std::conditional_t<multipass, std::tuple<>, std::optional<std::ranges::range_value_t<V>>> shown_ {};
+};
+
+template<typename R, typename Eq>
+dedup_adjacent_view(R &&, Eq) -> dedup_adjacent_view<std::views::all_t<R>, Eq>;
+
+namespace detail {
+
+template<typename Eq>
+struct dedup_adjacent_closure {
+  Eq eq_;
+
+  template<std::ranges::viewable_range R>
+  friend auto operator|(R && rg, dedup_adjacent_closure const & self) {
+    return dedup_adjacent_view { std::views::all(std::forward<R>(rg)), self.eq_ };
+  }
+};
+
+struct dedup_adjacent_adaptor {
+  template<std::ranges::viewable_range R, typename Eq = std::equal_to<>>
+  auto operator()(R && rg, Eq eq = {}) const {
+    return dedup_adjacent_view { std::views::all(std::forward<R>(rg)), std::move(eq) };
+  }
+
+  template<typename Eq>
+    requires (!std::ranges::range<Eq>)
+  auto operator()(Eq eq) const -> dedup_adjacent_closure<Eq> {
+    return { std::move(eq) };
+  }
+
+  template<std::ranges::viewable_range R>
+  friend auto operator|(R && rg, dedup_adjacent_adaptor const &) {
+    return dedup_adjacent_view { std::views::all(std::forward<R>(rg)), std::equal_to<>() };
+  }
+};
+
+} /* namespace detail */
+
+//  rg | dedup_adjacent, rg | dedup_adjacent(eq), dedup_adjacent(rg[, eq]).
+inline constexpr detail::dedup_adjacent_adaptor dedup_adjacent {};
+
+} /* namespace clst::views */
+
+//  MARK: namespace clst
+namespace clst {
+
+/*
+ *  MARK: to()
+ *  Runs a pipeline into a new C constructed from args (an allocator, say).
+ *  A list drawing on a node_pool gets a sized range through append_range, so
+ *  its nodes are allocated as one run; anything else is built element by
+ *  element as the pipeline yields, with emplace_back or, for an ordered
+ *  container, insert.  The C++23 std::ranges::to, for clst's containers.
+ */
+template<typename C, std::ranges::input_range R, typename... Args>
+auto to(R && rg, Args &&... args) -> C {
+  C out(std::forward<Args>(args)...);
+  if constexpr (std::ranges::sized_range<R> && requires { clst::append_range(out, rg); }) {
+    clst::append_range(out, std::forward<R>(rg));
+  }
+  else {
+    for (auto && el : rg) {
+      if constexpr (requires { out.emplace_back(std::forward<decltype(el)>(el)); }) {
+        out.emplace_back(std::forward<decltype(el)>(el));
+      }
+      else {
+        out.insert(std::forward<decltype(el)>(el));
+      }
+    }
+  }
+  return out;
+}
+
+namespace detail {
+
+template<typename C, typename... Args>
+struct to_closure {
+  std::tuple<Args...> args_;
+
+  template<std::ranges::input_range R>
+  friend auto operator|(R && rg, to_closure && self) -> C {
+    return std::apply([&rg](auto &&... args) {
+      return clst::to<C>(std::forward<R>(rg), std::forward<decltype(args)>(args)...);
+    }, std::move(self.args_));
+  }
+};
+
+} /* namespace detail */
+
+//  rg | to<C>(args...)
+template<typename C, typename... Args>
+  requires (!(std::ranges::input_range<Args> || ...))
+auto to(Args &&... args) -> detail::to_closure<C, std::decay_t<Args>...> {
+  return { std::tuple<std::decay_t<Args>...>(std::forward<Args>(args)...) };
+}
+
+} /* namespace clst */
+
+#endif /* list_views_hpp */
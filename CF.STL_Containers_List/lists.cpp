@@ -20,24 +20,71 @@
 #include <memory>
 #include <type_traits>
 #include <list>
+#include <vector>
+#include <array>
+#include <ranges>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <filesystem>
+#include <stdexcept>
+#include <cassert>
+#include <cctype>
+
+#include "stopwatch.hpp"
+#include "node_pool.hpp"
+#include "unrolled_list.hpp"
+#include "fast_sort.hpp"
+#include "parallel_sort.hpp"
+#include "tracking.hpp"
+#include "list_format.hpp"
+#include "simd_compare.hpp"
+#include "concurrent_list.hpp"
+#include "intrusive_list.hpp"
+#include "indexed_list.hpp"
+#include "lru_cache.hpp"
+#include "indexed_sequence.hpp"
+#include "sorted_list.hpp"
+#include "mapped_list.hpp"
+#include "external_sort.hpp"
+#include "static_list.hpp"
+#include "compact_list.hpp"
+#include "bulk_insert.hpp"
+#include "dedup.hpp"
+#include "parallel_algorithms.hpp"
+#include "list_views.hpp"
+#include "instrumented_list.hpp"
+#include "workload.hpp"
+#include "compaction.hpp"
+#include "string_arena.hpp"
 
 using namespace std::literals::string_literals;
+using namespace std::literals::string_view_literals;
 
 //  MARK: - Definitions
 
 //  MARK: - Local Constants.
 namespace konst {
 
-auto delimiter(char const dc = '-', size_t sl = 80) -> std::string const {
-  auto const dlm = std::string(sl, dc);
-  return dlm;
+//  Each distinct rule is built once and handed out by reference thereafter.
+auto delimiter(char const dc = '-', size_t sl = 80) -> std::string const & {
+  static std::mutex mtx;
+  static std::map<std::pair<char, size_t>, std::string> cache;
+
+  std::lock_guard<std::mutex> lock { mtx };
+  auto [it, added] = cache.try_emplace({ dc, sl, });
+  if (added) {
+    it->second.assign(sl, dc);
+  }
+  return it->second;
 }
 
 static
-auto const dlm = delimiter();
+auto const & dlm = delimiter();
 
 static
-auto const dot = delimiter('.');
+auto const & dot = delimiter('.');
 
 } /* namespace konst */
 
@@ -57,9 +104,7 @@ int main(int argc, const char * argv[]) {
   std::cout << "C++ Version: "s << __cplusplus << std::endl;
 
   std::cout << '\n' << konst::dlm << std::endl;
-  C_list(argc, argv);
-
-  return 0;
+  return C_list(argc, argv);
 }
 
 //  MARK: C_list
@@ -68,15 +113,95 @@ int main(int argc, const char * argv[]) {
 //  MARK: namespace clst
 namespace clst {
 
+template<typename T, typename A>
+std::ostream & operator<<(std::ostream & os, const std::list<T, A> & container) {
+  return print_list(os, container);
+}
+
+template<typename T, std::size_t B, typename A>
+std::ostream & operator<<(std::ostream & os, const unrolled_list<T, B, A> & container) {
+  return print_list(os, container);
+}
+
+template<typename T, typename A>
+std::ostream & operator<<(std::ostream & os, const indexed_sequence<T, A> & container) {
+  return print_list(os, container);
+}
+
+template<typename T, typename C>
+std::ostream & operator<<(std::ostream & os, const sorted_list<T, C> & container) {
+  return print_list(os, container);
+}
+
 template<typename T>
-std::ostream & operator<<(std::ostream & os, const std::list<T> & container) {
-  os.put('[');
-  char comma[3] = { '\0', ' ', '\0', };
-  for (auto const & el : container) {
-    os << comma << el;
-    comma[0] = ',';
-  }
-  return os << ']';
+std::ostream & operator<<(std::ostream & os, const mapped_list<T> & container) {
+  return print_list(os, container);
+}
+
+template<typename T, std::size_t N>
+std::ostream & operator<<(std::ostream & os, const static_list<T, N> & container) {
+  return print_list(os, container);
+}
+
+template<typename T, typename I>
+std::ostream & operator<<(std::ostream & os, const compact_list<T, I> & container) {
+  return print_list(os, container);
+}
+
+/*
+ *  MARK: compare_allocators()
+ *  Run a section's body once on a clst::pooled_list and show the result, then
+ *  repeat it 'reps' times with std::allocator and with a clst::node_pool and
+ *  report the time and the number of trips to the global allocator.  The
+ *  std::allocator calls are counted by an untimed second run of that loop
+ *  through clst::tracking_allocator, in a "compare_allocators" tracking section.
+ */
+template<typename T, typename Body>
+auto compare_allocators(std::size_t reps, Body body) -> void {
+  {
+    pooled_list<T> pooled;
+    body(pooled);
+    std::cout << "with clst::pooled_list: "s << pooled << '\n';
+  }
+
+  auto const std_ms = time_ms([&]() {
+    for (std::size_t rp = 0; rp < reps; ++rp) {
+      std::list<T> lst;
+      body(lst);
+    }
+  });
+
+  std::size_t std_calls = 0;
+  {
+    tracking_scope scope { "compare_allocators"sv };
+    auto const before = tracking::current().allocations;
+    for (std::size_t rp = 0; rp < reps; ++rp) {
+      std::list<T, tracking_allocator<T>> lst;
+      body(lst);
+    }
+    std_calls = tracking::current().allocations - before;
+  }
+
+  node_pool<T> pool;
+  auto const pool_ms = time_ms([&]() {
+    for (std::size_t rp = 0; rp < reps; ++rp) {
+      pooled_list<T> lst { pool_allocator<T> { pool } };
+      body(lst);
+    }
+  });
+
+  auto const & st = pool.stats();
+  auto const flags = std::cout.flags();
+  auto const precision = std::cout.precision();
+  std::cout << std::fixed << std::setprecision(3)
+            << reps << " reps:\n"s
+            << "  std::allocator : "s << std::setw(9) << std_ms << " ms, "s
+            << std_calls << " calls to operator new\n"s
+            << "  clst::node_pool: "s << std::setw(9) << pool_ms << " ms, "s
+            << st.chunks << " calls to operator new ("s
+            << st.reused << " nodes reused)\n"s;
+  std::cout.flags(flags);
+  std::cout.precision(precision);
 }
 
 } /* namespace clst */
@@ -88,6 +213,29 @@ std::ostream & operator<<(std::ostream & os, const std::list<T> & container) {
 auto C_list(int argc, const char * argv[]) -> decltype(argc) {
   std::cout << "In "s << __func__ << std::endl;
 
+  //  --latency prints the latencies of the instrumented sections at the end,
+  //  --latency=json prints them as JSON (build with -DCLST_INSTRUMENT=1).
+  auto const latency_arg = std::find_if(argv + 1, argv + argc, [](char const * arg) {
+    return std::string_view(arg).starts_with("--latency"sv);
+  });
+
+  //  --replay [FILE] [key=value ...] replays a workload (see workload.hpp)
+  //  instead of the tour: a spec file, then overrides, in the order given.
+  if (auto const replay_arg = std::find_if(argv + 1, argv + argc, [](char const * arg) {
+        return std::string_view(arg) == "--replay"sv;
+      }); replay_arg != argv + argc) {
+    try {
+      clst::workload_spec spec;
+      std::for_each(replay_arg + 1, argv + argc, [&spec](char const * arg) { spec.apply(arg); });
+      clst::replay(spec, std::cout);
+    }
+    catch (std::exception const & ex) {
+      std::cerr << ex.what() << '\n';
+      return 2;
+    }
+    return 0;
+  }
+
   /// Member functions
   // ....+....!....+....!....+....!....+....!....+....!....+....!
   std::cout << konst::dot << '\n';
@@ -140,6 +288,47 @@ auto C_list(int argc, const char * argv[]) -> decltype(argc) {
     std::list<std::string> words4(5, "Mo"s);
     std::cout << "words4: "s << words4 << '\n';
 
+    // The same text through the buffered writer: one stream write per list.
+    std::cout << "words1: "s << clst::fast(words1) << '\n';
+
+    // The same constructions with interned strings: the copies in iwords2 and
+    // iwords3 and the five elements of iwords4 point at one copy of each text.
+    {
+      istring_list<> iwords1 { "the", "frogurt", "is", "also", "cursed", };
+      istring_list<> iwords2(iwords1.begin(), iwords1.end());
+      istring_list<> iwords3(iwords1);
+      istring_list<> iwords4(5, "Mo");
+      std::cout << "iwords4: "s << iwords4 << ", one \"Mo\": "s << std::boolalpha
+                << (iwords4.front().data() == iwords4.back().data()) << std::noboolalpha
+                << ", iwords3 == iwords1: "s << (iwords3 == iwords1 ? "yes"s : "no"s) << '\n';
+    }
+
+    // The same constructions with clst::tracked elements in clst::tracking_allocator
+    // nodes.  Nothing is printed here; the counts appear in the summary at the end.
+    {
+      using tstring = tracked<std::string>;
+      using tlist = std::list<tstring, tracking_allocator<tstring>>;
+
+      tracking_scope section { "constructor"sv };
+      tlist words1 { "the"s, "frogurt"s, "is"s, "also"s, "cursed"s, };
+      {
+        tracking_scope scope { "constructor: range"sv };
+        tlist words2(words1.begin(), words1.end());
+      }
+      {
+        tracking_scope scope { "constructor: copy"sv };
+        tlist words3(words1);
+      }
+      {
+        tracking_scope scope { "constructor: count"sv };
+        tlist words4(5, "Mo"s);
+      }
+      {
+        tracking_scope scope { "constructor: move"sv };
+        tlist words5(std::move(words1));
+      }
+    }
+
     std::cout << '\n';
   }
 
@@ -339,6 +528,12 @@ auto C_list(int argc, const char * argv[]) -> decltype(argc) {
     std::for_each(container.begin(), container.end(), print);
     std::cout << "\nSize=s" << container.size() << '\n';
 
+    clst::compare_allocators<int>(100'000, [](auto & lst) {
+      lst.assign({ 1, 2, 3, });
+      lst.clear();
+      lst.push_back(4);
+    });
+
     std::cout << '\n';
   }
 
@@ -383,6 +578,17 @@ auto C_list(int argc, const char * argv[]) -> decltype(argc) {
       std::cout << ' ' << obj.str;
     std::cout << '\n';
 
+    {
+      using tstring = clst::tracked<std::string>;
+      clst::tracking_scope scope { "emplace"sv };
+      std::list<tstring, clst::tracking_allocator<tstring>> things;
+      tstring two { "two"s };
+      tstring three { "three"s };
+      things.emplace(things.end(), "one"s);
+      things.emplace(things.end(), two);
+      things.emplace(things.end(), std::move(three));
+    }
+
     std::cout << '\n';
   }
 
@@ -398,7 +604,8 @@ auto C_list(int argc, const char * argv[]) -> decltype(argc) {
       std::cout << '\n';
     };
 
-    std::list<int> container { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, };
+    clst::latency_scope scope { "erase"sv };
+    clst::instrumented_list<int> container { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, };
     print_container(container);
 
     container.erase(container.begin());
@@ -423,6 +630,15 @@ auto C_list(int argc, const char * argv[]) -> decltype(argc) {
     }
     print_container(container);
 
+    clst::compare_allocators<int>(100'000, [](auto & lst) {
+      lst.assign({ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, });
+      lst.erase(lst.begin());
+      lst.erase(std::next(lst.begin(), 2), std::next(lst.begin(), 5));
+      for (auto it = lst.begin(); it != lst.end(); ) {
+        it = (*it % 2 == 0) ? lst.erase(it) : std::next(it);
+      }
+    });
+
     std::cout << '\n';
   }
 
@@ -430,7 +646,8 @@ auto C_list(int argc, const char * argv[]) -> decltype(argc) {
   std::cout << konst::dot << '\n';
   std::cout << "std::C_list - push_back"s << '\n';
   {
-    std::list<std::string> letters;
+    clst::latency_scope scope { "push_back"sv };
+    clst::instrumented_list<std::string> letters;
 
     letters.push_back("abc"s);
     std::string str = "def"s;
@@ -442,6 +659,12 @@ auto C_list(int argc, const char * argv[]) -> decltype(argc) {
     }
     std::cout << "\nMoved-from string holds "s << std::quoted(str) << '\n';
 
+    clst::compare_allocators<std::string>(100'000, [](auto & lst) {
+      lst.push_back("abc"s);
+      std::string str = "def"s;
+      lst.push_back(std::move(str));
+    });
+
     std::cout << '\n';
   }
 
@@ -488,6 +711,32 @@ auto C_list(int argc, const char * argv[]) -> decltype(argc) {
                 << president.country << " in "s << president.year << ".\n"s;
     }
 
+    {
+      using tstring = clst::tracked<std::string>;
+      clst::tracking_scope section { "emplace_back section"sv };
+      std::list<tstring, clst::tracking_allocator<tstring>> names;
+      {
+        clst::tracking_scope scope { "emplace_back"sv };
+        names.emplace_back("Nelson Mandela"s);
+      }
+      {
+        clst::tracking_scope scope { "push_back"sv };
+        names.push_back(tstring("Franklin Delano Roosevelt"s));
+      }
+    }
+
+    std::cout << "\nemplace_back into clst::pooled_list:\n"s;
+    clst::pooled_list<President> pooled;
+    pooled.emplace_back("Nelson Mandela"s, "South Africa"s, 1994);
+    std::cout << "pool served "s << clst::node_pool<President>::shared().stats().allocations
+              << " node(s)\n"s;
+
+    // President announces every construction, so time std::string in its place.
+    clst::compare_allocators<std::string>(100'000, [](auto & lst) {
+      lst.emplace_back("Nelson Mandela"s);
+      lst.emplace_back(5, 'M');
+    });
+
     std::cout << '\n';
   }
 
@@ -539,6 +788,12 @@ auto C_list(int argc, const char * argv[]) -> decltype(argc) {
     for (auto & el : container) { std::cout << el << ' '; }
     std::cout << '\n';
 
+    clst::compare_allocators<int>(100'000, [](auto & lst) {
+      lst.assign({ 1, 2, 3, });
+      lst.resize(5);
+      lst.resize(2);
+    });
+
     std::cout << '\n';
   }
 
@@ -574,8 +829,9 @@ auto C_list(int argc, const char * argv[]) -> decltype(argc) {
   {
     using namespace clst;
 
-    std::list<int> list1 = { 5,9,0,1,3, };
-    std::list<int> list2 = { 8,7,2,6,4, };
+    latency_scope scope { "merge"sv };
+    instrumented_list<int> list1 = { 5,9,0,1,3, };
+    instrumented_list<int> list2 = { 8,7,2,6,4, };
 
     list1.sort();
     list2.sort();
@@ -584,6 +840,22 @@ auto C_list(int argc, const char * argv[]) -> decltype(argc) {
     list1.merge(list2);
     std::cout << "merged: "s << list1 << '\n';
 
+    // The same sort and merge, split into runs across a pool of threads.
+    std::list<int> list3 = { 5, 9, 0, 1, 3, 8, 7, 2, 6, 4, };
+    thread_pool pool { 4 };
+    parallel_sort(list3, std::less<int>(), pool, 2);
+    std::cout << "parallel_sort: "s << list3 << '\n';
+
+    // Reductions over the same pool: the list is cut into segments that are
+    // walked on separate threads and combined in order.
+    auto const segs = par::make_segments(list3, 2);
+    std::cout << "par::transform_reduce: "s
+              << par::transform_reduce(pool, segs, 0, std::plus<>(), [](int val) { return val * val; }) << '\n';
+    std::cout << "par::count_if (odd): "s
+              << par::count_if(pool, segs, [](int val) { return val % 2 != 0; }) << '\n';
+    par::remove_if(pool, list3, [](int val) { return val % 3 == 0; });
+    std::cout << "par::remove_if (x3): "s << list3 << '\n';
+
     std::cout << '\n';
   }
 
@@ -593,8 +865,9 @@ auto C_list(int argc, const char * argv[]) -> decltype(argc) {
   {
     using namespace clst;
 
-    std::list<int> list1 = { 1, 2, 3, 4, 5, };
-    std::list<int> list2 = { 10, 20, 30, 40, 50, };
+    latency_scope scope { "splice"sv };
+    instrumented_list<int> list1 = { 1, 2, 3, 4, 5, };
+    instrumented_list<int> list2 = { 10, 20, 30, 40, 50, };
 
     auto it = list1.begin();
     std::advance(it, 2);
@@ -618,7 +891,8 @@ auto C_list(int argc, const char * argv[]) -> decltype(argc) {
   {
     using namespace clst;
 
-    std::list<int> container = { 1, 100, 2, 3, 10, 1, 11, -1, 12, };
+    latency_scope scope { "remove, remove_if"sv };
+    instrumented_list<int> container = { 1, 100, 2, 3, 10, 1, 11, -1, 12, };
     std::cout << "before remove           : "s << container << '\n';
 
     container.remove(1); // remove both elements equal to 1
@@ -653,13 +927,19 @@ auto C_list(int argc, const char * argv[]) -> decltype(argc) {
   {
     using namespace clst;
 
-    std::list<int> container = { 1, 2, 2, 3, 3, 2, 1, 1, 2, };
+    latency_scope scope { "unique"sv };
+    instrumented_list<int> container = { 1, 2, 2, 3, 3, 2, 1, 1, 2, };
 
     std::cout << "contents before        : "s << container << '\n';
 
     container.unique();
     std::cout << "contents after unique(): "s << container << '\n';
 
+    // Every later duplicate, adjacent or not, in one pass and in place
+    std::list<int> again = { 1, 2, 2, 3, 3, 2, 1, 1, 2, };
+    auto const erased = dedup(again);
+    std::cout << "contents after dedup() : "s << again << ", "s << erased << " erased\n"s;
+
     std::cout << '\n';
   }
 
@@ -669,7 +949,8 @@ auto C_list(int argc, const char * argv[]) -> decltype(argc) {
   {
     using namespace clst;
 
-    std::list<int> list = { 8, 7, 5, 9, 0, 1, 3, 2, 6, 4, };
+    latency_scope scope { "sort"sv };
+    instrumented_list<int> list = { 8, 7, 5, 9, 0, 1, 3, 2, 6, 4, };
 
     std::cout << "before:     "s << list << '\n';
     list.sort();
@@ -677,6 +958,13 @@ auto C_list(int argc, const char * argv[]) -> decltype(argc) {
     list.sort(std::greater<int>());
     std::cout << "descending: "s << list << '\n';
 
+    // clst::fast_sort relinks the same nodes, so references follow their elements.
+    int const & nine = list.front();
+    fast_sort(list);
+    std::cout << "fast_sort ascending:  "s << list << " ('nine' still reads "s << nine << ")\n"s;
+    fast_sort(list, std::greater<int>());
+    std::cout << "fast_sort descending: "s << list << '\n';
+
     std::cout << '\n';
   }
 
@@ -711,13 +999,31 @@ auto C_list(int argc, const char * argv[]) -> decltype(argc) {
     std::cout << '\n';
 
 #if (__cplusplus > 201707L)
-    //  TODO:  add spaceship operator tests
+    // Compare with the spaceship operator
     auto eq = std::is_eq  (alice <=> eve);
     auto ne = std::is_neq (alice <=> eve);
     auto lt = std::is_lt  (alice <=> eve);
     auto le = std::is_lteq(alice <=> eve);
     auto gt = std::is_gt  (alice <=> eve);
     auto ge = std::is_gteq(alice <=> eve);
+    std::cout << "alice <=> eve: is_eq "s << eq << ", is_neq "s << ne
+              << ", is_lt "s << lt << ", is_lteq "s << le
+              << ", is_gt "s << gt << ", is_gteq "s << ge << '\n';
+    std::cout << "alice <=> bob: is_lt "s << std::is_lt(alice <=> bob) << '\n';
+    std::cout << '\n';
+
+    // Snapshots in contiguous or chunked storage compare through clst::equal and
+    // clst::compare_three_way, a vector register at a time, with the same results.
+    std::vector<int> alice_v(alice.begin(), alice.end());
+    std::vector<int> bob_v(bob.begin(), bob.end());
+    clst::unrolled_list<int> eve_u(eve.begin(), eve.end());
+    std::cout << "clst kernels: "s << clst::simd_isa() << '\n';
+    std::cout << "clst::equal(alice, eve) returns "s << clst::equal(alice_v, eve_u) << '\n';
+    std::cout << "clst::equal(alice, bob) returns "s << clst::equal(alice_v, bob_v) << '\n';
+    std::cout << "clst::compare_three_way(alice, eve) == (alice <=> eve) returns "s
+              << (clst::compare_three_way(alice_v, eve_u) == (alice <=> eve)) << '\n';
+    std::cout << "clst::compare_three_way(alice, bob) == (alice <=> bob) returns "s
+              << (clst::compare_three_way(alice_v, bob_v) == (alice <=> bob)) << '\n';
 #endif  /* (__cplusplus > 201707L) */
 
     std::cout << std::boolalpha;
@@ -788,6 +1094,698 @@ auto C_list(int argc, const char * argv[]) -> decltype(argc) {
     std::cout << '\n';
   }
 
+  /// clst::unrolled_list
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "clst::unrolled_list - every section above, chunked"s << '\n';
+  {
+    using namespace clst;
+    using ulist = unrolled_list<int>;
+
+    std::cout << "ints per 64-byte chunk: "s << ulist::capacity << '\n';
+
+    // std::C_list
+    ulist lst = { 7, 5, 16, 8, };
+    lst.push_front(25);
+    lst.push_back(13);
+    auto it = std::find(lst.begin(), lst.end(), 16);
+    if (it != lst.end()) {
+      lst.insert(it, 42);
+    }
+    std::cout << "lst:                 "s << lst << '\n';
+
+    // constructor
+    unrolled_list<std::string> words1 { "the"s, "frogurt"s, "is"s, "also"s, "cursed"s, };
+    unrolled_list<std::string> words2(words1.begin(), words1.end());
+    unrolled_list<std::string> words3(words1);
+    unrolled_list<std::string> words4(5, "Mo"s);
+    std::cout << "words2, 3, 4:        "s << words2 << words3 << words4 << '\n';
+
+    // operator=, assign
+    ulist nums1 { 3, 1, 4, 6, 5, 9, };
+    ulist nums2 = nums1;
+    ulist nums3 = std::move(nums1);
+    std::cout << "nums1, 2, 3 sizes:   "s << nums1.size() << ' ' << nums2.size() << ' ' << nums3.size() << '\n';
+
+    unrolled_list<char> characters;
+    characters.assign(5, 'a');
+    std::cout << "assign:              "s << characters;
+    const std::string extra(6, 'b');
+    characters.assign(extra.begin(), extra.end());
+    std::cout << characters;
+    characters.assign({ 'C', '+', '+', '1', '1', });
+    std::cout << characters << '\n';
+
+    // front, back
+    unrolled_list<char> letters { 'o', 'm', 'g', 'w', 't', 'f', };
+    std::cout << "front, back:         "s << letters.front() << ' ' << letters.back() << '\n';
+
+    // iterators
+    ulist nums { 1, 2, 4, 8, 16, };
+    std::cout << "sum, reverse sum:    "s << std::accumulate(nums.begin(), nums.end(), 0) << ' '
+              << std::accumulate(nums.rbegin(), nums.rend(), 0) << '\n';
+
+    // capacity
+    ulist numbers;
+    std::cout << std::boolalpha << "empty, size:         "s << numbers.empty();
+    numbers.push_back(42);
+    numbers.push_back(13'317);
+    std::cout << ' ' << numbers.empty() << ' ' << numbers.size() << '\n';
+
+    // clear, emplace, erase
+    numbers.clear();
+    std::cout << "after clear:         "s << numbers << '\n';
+
+    unrolled_list<std::string> things;
+    things.emplace(things.end(), "one"s);
+    things.emplace(things.end(), 3, 't');
+    std::cout << "emplace:             "s << things << '\n';
+
+    ulist container { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, };
+    container.erase(container.begin());
+    container.erase(std::next(container.begin(), 2), std::next(container.begin(), 5));
+    for (auto ie = container.begin(); ie != container.end(); ) {
+      ie = (*ie % 2 == 0) ? container.erase(ie) : std::next(ie);
+    }
+    std::cout << "erase:               "s << container << '\n';
+
+    // push_back, emplace_back, pop_back, resize
+    unrolled_list<std::string> strs;
+    strs.push_back("abc"s);
+    strs.emplace_back("def"s);
+    strs.pop_back();
+    std::cout << "push/emplace/pop:    "s << strs << '\n';
+
+    ulist sized = { 1, 2, 3, };
+    sized.resize(5);
+    std::cout << "resize 5, 2:         "s << sized;
+    sized.resize(2);
+    std::cout << sized << '\n';
+
+    // swap
+    ulist a1 { 1, 2, 3, }, a2 { 4, 5, };
+    int & ref1 = a1.front();
+    a1.swap(a2);
+    std::cout << "swap:                "s << a1 << a2 << ' ' << ref1 << '\n';
+
+    // merge
+    ulist list1 = { 5, 9, 0, 1, 3, };
+    ulist list2 = { 8, 7, 2, 6, 4, };
+    list1.sort();
+    list2.sort();
+    list1.merge(list2);
+    std::cout << "merge:               "s << list1 << list2 << '\n';
+
+    // splice
+    ulist sp1 = { 1, 2, 3, 4, 5, };
+    ulist sp2 = { 10, 20, 30, 40, 50, };
+    auto at = std::next(sp1.begin(), 2);
+    sp1.splice(at, sp2);
+    std::cout << "splice:              "s << sp1 << sp2;
+    sp2.splice(sp2.begin(), sp1, std::next(sp1.begin(), 7), sp1.end());
+    std::cout << ' ' << sp1 << sp2 << '\n';
+
+    // splicing an element onto itself, or in front of its successor, does nothing
+    ulist self = { 1, 2, 3, 4, 5, };
+    self.splice(self.begin(), self, self.begin());
+    self.splice(std::next(self.begin(), 3), self, std::next(self.begin(), 2));
+    self.splice(std::next(self.begin(), 2), self, std::next(self.begin(), 2), std::next(self.begin(), 4));
+    std::cout << "splice onto itself:  "s << self << ' ' << self.size() << '\n';
+
+    // remove, remove_if
+    ulist rem = { 1, 100, 2, 3, 10, 1, 11, -1, 12, };
+    rem.remove(1);
+    rem.remove_if([](int nr) { return nr > 10; });
+    std::cout << "remove, remove_if:   "s << rem << '\n';
+
+    // reverse, unique, sort
+    ulist rev = { 8, 7, 5, 9, 0, 1, 3, 2, 6, 4, };
+    rev.sort();
+    rev.reverse();
+    std::cout << "sort, reverse:       "s << rev << '\n';
+
+    ulist uniq = { 1, 2, 2, 3, 3, 2, 1, 1, 2, };
+    uniq.unique();
+    std::cout << "unique:              "s << uniq << '\n';
+
+    rev.sort(std::greater<int>());
+    std::cout << "sort descending:     "s << rev << '\n';
+
+    // std::operator==, etc.
+    ulist alice { 1, 2, 3, };
+    ulist bob   { 7, 8, 9, 10, };
+    ulist eve   { 1, 2, 3, };
+    std::cout << "alice == eve, < bob: "s << (alice == eve) << ' ' << (alice < bob) << '\n';
+
+    // std::erase, std::erase_if
+    unrolled_list<char> cnt(10);
+    std::iota(cnt.begin(), cnt.end(), '0');
+    erase(cnt, '3');
+    auto erased = erase_if(cnt, [](char xl) { return (xl - '0') % 2 == 0; });
+    std::cout << "erase, erase_if:     "s << cnt << ' ' << erased << " erased\n"s;
+
+    std::cout << '\n';
+  }
+
+  /// clst::concurrent_list
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "clst::concurrent_list - find, insert and remove from four threads"s << '\n';
+  {
+    // The first section's list, shared by four threads without a lock
+    clst::concurrent_list<int> lst;
+    for (int nr : { 13, 8, 16, 5, 7, 25, }) {
+      lst.push_front(nr);
+    }
+
+    // Each thread adds ten values, puts its marker before 16 and removes its odd values
+    std::vector<std::thread> threads;
+    for (int th = 1; th <= 4; ++th) {
+      threads.emplace_back([&lst, th]() {
+        for (int nr = th * 100; nr < th * 100 + 10; ++nr) {
+          lst.push_front(nr);
+        }
+        lst.insert_before(16, 42 * th);
+        lst.remove_if([th](int nr) { return nr / 100 == th && nr % 2 == 1; });
+      });
+    }
+    for (auto & th : threads) {
+      th.join();
+    }
+
+    std::cout << std::boolalpha;
+    std::cout << "find(16): "s << lst.find(16) << ", find(101): "s << lst.find(101)
+              << ", size(): "s << lst.size() << '\n';
+
+    // Threads interleave differently on every run, so show the contents in order
+    std::list<int> snapshot;
+    lst.for_each([&snapshot](int nr) { snapshot.push_back(nr); });
+    snapshot.sort();
+    std::cout << "sorted contents: "s;
+    clst::print_list(std::cout, snapshot) << '\n';
+
+    std::cout << '\n';
+  }
+
+  /// clst::intrusive_list
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "clst::intrusive_list - emplace and emplace_back without nodes"s << '\n';
+  {
+    // The emplace_back section's President, now carrying its own links:
+    // one for the order of election and one for the list of re-elections.
+    struct President
+    {
+      std::string name;
+      std::string country;
+      int year;
+      clst::list_hook by_year;
+      clst::list_hook re_elected;
+
+      President(std::string p_name, std::string p_country, int p_year)
+        : name(std::move(p_name)), country(std::move(p_country)), year(p_year) {
+        std::cout << "I am being constructed.\n"s;
+      }
+
+      President(President && other)
+        : name(std::move(other.name)), country(std::move(other.country)), year(other.year)
+      {
+        std::cout << "I am being moved.\n"s;
+      }
+    };
+
+    // The objects live in an arena that outlives the lists.
+    std::vector<President> arena;
+    arena.reserve(3);
+    std::cout << "construct in the arena:\n"s;
+    arena.emplace_back("Nelson Mandela"s, "South Africa"s, 1994);
+    arena.emplace_back("Franklin Delano Roosevelt"s, "the USA"s, 1936);
+    arena.emplace_back("Franklin Delano Roosevelt"s, "the USA"s, 1932);
+
+    clst::intrusive_list<President, &President::by_year> elections;
+    clst::intrusive_list<President, &President::re_elected> reElections;
+    std::cout << "\npush_back (nothing is constructed, moved or allocated):\n"s;
+    for (auto & president : arena) {
+      elections.push_back(president);
+    }
+    reElections.push_back(arena[1]);
+
+    elections.sort([](President const & lhs, President const & rhs) { return lhs.year < rhs.year; });
+
+    std::cout << "\nContents:\n"s;
+    for (President const & president : elections) {
+      std::cout << president.name << " was elected president of "s
+                << president.country << " in "s << president.year << ".\n"s;
+    }
+    for (President const & president : reElections) {
+      std::cout << president.name << " was re-elected president of "s
+                << president.country << " in "s << president.year << ".\n"s;
+    }
+
+    // Unlink by reference: no search, and the object stays where it is.
+    elections.unlink(arena[1]);
+    std::cout << "\nafter elections.unlink(arena[1]): "s << elections.size() << " elected, "s
+              << reElections.size() << " re-elected, "s << arena[1].name << " still in the arena\n"s;
+
+    // The emplace section with clst::tracked strings, the objects in a
+    // std::array: the tracking summary shows no allocation, copy or move.
+    {
+      struct Athing {
+        clst::tracked<std::string> str;
+        clst::list_hook hook;
+
+        explicit Athing(std::string p_str) : str(std::move(p_str)) {}
+      };
+
+      clst::tracking_scope scope { "intrusive_list"sv };
+      std::array<Athing, 3> things { Athing { "one"s }, Athing { "two"s }, Athing { "three"s }, };
+
+      clst::intrusive_list<Athing, &Athing::hook> container;
+      for (auto & thing : things) {
+        container.insert(container.end(), thing);
+      }
+
+      std::cout << "\ncontent:\n"s;
+      for (auto const & obj : container) {
+        std::cout << ' ' << obj.str;
+      }
+      std::cout << '\n';
+    }
+
+    std::cout << '\n';
+  }
+
+  /// clst::indexed_list, clst::lru_cache
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "clst::indexed_list, clst::lru_cache - find by key without a scan"s << '\n';
+  {
+    // The std::C_list section again: the insertion point comes from the index
+    clst::indexed_list<int, std::string> lst = {
+      { 7, "seven"s, }, { 5, "five"s, }, { 16, "sixteen"s, }, { 8, "eight"s, },
+    };
+    lst.push_front(25, "twenty-five"s);
+    lst.push_back(13, "thirteen"s);
+
+    if (auto it = lst.find(16); it != lst.end()) {
+      lst.insert(it, 42, "forty-two"s);
+    }
+    // A key already present is not inserted twice
+    auto const [dup, inserted] = lst.push_back(5, "cinq"s);
+    std::cout << "push_back(5) inserted: "s << std::boolalpha << inserted
+              << ", existing value: "s << dup->second << std::noboolalpha << '\n';
+
+    lst.erase(8);
+    std::cout << "lst = { "s;
+    for (auto const & [key, name] : lst) {
+      std::cout << key << ':' << name << ", "s;
+    }
+    std::cout << "};\n"s;
+
+    // An LRU cache: a hit splices the entry to the front, a miss that fills
+    // the cache evicts from the back
+    clst::lru_cache<std::string, int> cache(3);
+    for (auto const & word : { "red"s, "green"s, "blue"s, "red"s, "cyan"s, "green"s, "red"s, }) {
+      if (auto * count = cache.get(word)) {
+        ++*count;
+      }
+      else {
+        cache.put(word, 1);
+      }
+    }
+    std::cout << "cache (most recent first) = { "s;
+    for (auto const & [word, count] : cache) {
+      std::cout << word << ':' << count << ", "s;
+    }
+    std::cout << "};\n"s;
+    auto const & st = cache.statistics();
+    std::cout << "hits: "s << st.hits << ", misses: "s << st.misses << ", evictions: "s << st.evictions << '\n';
+
+    std::cout << '\n';
+  }
+
+  /// clst::indexed_sequence
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "clst::indexed_sequence - erase and splice by position"s << '\n';
+  {
+    using namespace clst;
+
+    // The erase section: positions are reached in O(log n), not by std::advance
+    indexed_sequence<int> container { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, };
+    std::cout << container << '\n';
+
+    container.erase(container.begin());
+    std::cout << container << '\n';
+
+    auto range_begin = container.nth(2);
+    auto range_end = container.begin() + 5;
+    std::cout << "erase ["s << container.index_of(range_begin) << ", "s
+              << container.index_of(range_end) << "): "s;
+    container.erase(range_begin, range_end);
+    std::cout << container << '\n';
+    std::cout << "container[2] = "s << container[2] << '\n';
+
+    // The splice section: moving a range costs O(log n) whatever its length
+    indexed_sequence<int> list1 = { 1, 2, 3, 4, 5, };
+    indexed_sequence<int> list2 = { 10, 20, 30, 40, 50, };
+
+    auto it = list1.nth(2);
+    list1.splice(it, list2);
+    std::cout << "list1: "s << list1 << '\n';
+    std::cout << "list2: "s << list2 << '\n';
+
+    // 'it' still refers to 3, now at a new index
+    std::cout << "*it = "s << *it << " at index "s << list1.index_of(it) << '\n';
+    list2.splice(list2.begin(), list1, it, list1.end());
+    std::cout << "list1: "s << list1 << '\n';
+    std::cout << "list2: "s << list2 << '\n';
+
+    // split() is the inverse of splicing onto the end
+    auto tail = list2.split(list2.nth(1));
+    std::cout << "list2: "s << list2 << ", tail: "s << tail << '\n';
+
+    std::cout << '\n';
+  }
+
+  /// clst::sorted_list
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "clst::sorted_list - insert, find, merge and unique in order"s << '\n';
+  {
+    using namespace clst;
+
+    // The merge section without the sorts: the lists are never out of order
+    sorted_list<int> list1 = { 5, 9, 0, 1, 3, };
+    sorted_list<int> list2 = { 8, 7, 2, 6, 4, };
+    std::cout << "list1:  "s << list1 << '\n';
+    std::cout << "list2:  "s << list2 << '\n';
+    list1.merge(list2);
+    std::cout << "merged: "s << list1 << '\n';
+
+    // insert finds its own place; equal elements go after those already there
+    list1.insert(4);
+    list1.insert(11);
+    list1.insert(-1);
+    std::cout << "insert 4, 11, -1: "s << list1 << '\n';
+    auto [first, last] = list1.equal_range(4);
+    std::cout << "equal_range(4) at "s << std::distance(list1.begin(), first) << ", count "s
+              << std::distance(first, last) << ", lower_bound(10): "s << *list1.lower_bound(10) << '\n';
+
+    // The unique section: in a sorted list every duplicate is adjacent
+    sorted_list<int> container = { 1, 2, 2, 3, 3, 2, 1, 1, 2, };
+    std::cout << "contents before        : "s << container << '\n';
+    container.unique();
+    std::cout << "contents after unique(): "s << container << '\n';
+    std::cout << "find(3): "s << (container.find(3) != container.end() ? "found"s : "absent"s)
+              << ", erase(2): "s << container.erase(2) << " -> "s << container << '\n';
+
+    std::cout << '\n';
+  }
+
+  /// clst::mapped_list
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "clst::mapped_list - a list that outlives the process"s << '\n';
+  {
+    using namespace clst;
+
+    auto const file = std::filesystem::temp_directory_path() / "CF.STL_Containers_List.mapped"s;
+    std::filesystem::remove(file);
+    {
+      // The std::C_list section, with the nodes in a file
+      mapped_list<int> lst(file);
+      for (auto nr : { 7, 5, 16, 8, }) {
+        lst.push_back(nr);
+      }
+      lst.push_front(25);
+      lst.push_back(13);
+      lst.insert(std::find(lst.begin(), lst.end(), 16), 42);
+      std::cout << "written:  "s << lst << " in "s << std::filesystem::file_size(file) << " bytes\n"s;
+    }
+    {
+      // A later run maps the file and walks the list as it was left
+      mapped_list<int> lst(file);
+      std::cout << "reopened: "s << lst << '\n';
+      lst.erase(std::find(lst.begin(), lst.end(), 8));
+      lst.push_back(99);  // reuses the node 8 was in
+      std::cout << "edited:   "s << lst << ", capacity "s << lst.capacity() << '\n';
+    }
+    std::cout << "again:    "s << mapped_list<int>(file) << '\n';
+    std::filesystem::remove(file);
+
+    std::cout << '\n';
+  }
+
+  /// clst::external_sorter
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "clst::external_sorter - sort more than fits in memory"s << '\n';
+  {
+    using namespace clst;
+
+    // Memory for three elements at a time: four runs on disk, merged two at a time
+    external_sort_options opts;
+    opts.memory_bytes = 3 * external_sorter<int>::bytes_per_element;
+    opts.fan_in = 2;
+    external_sorter<int> sorter { opts };
+    for (auto nr : { 5, 9, 0, 1, 3, 8, 7, 2, 6, 4, }) {
+      sorter.push(nr);
+    }
+    std::list<int> sorted;
+    sorter.finish([&sorted](int nr) { sorted.push_back(nr); });
+    std::cout << "sorted: "s << sorted << '\n';
+    std::cout << "runs: "s << sorter.statistics().runs
+              << ", merge passes: "s << sorter.statistics().merge_passes
+              << ", bytes written: "s << sorter.statistics().bytes_written << '\n';
+
+    std::cout << '\n';
+  }
+
+  /// clst::static_list
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "clst::static_list - assign, front, back and pop_back without the heap"s << '\n';
+  {
+    using namespace clst;
+    using tchar = tracked<char>;
+
+    // Built and sorted by the compiler; the program only reads the result
+    constexpr auto digits = []() {
+      static_list<int, 10> lst { 5, 9, 0, 1, 3, 8, 7, 2, 6, 4, };
+      lst.sort();
+      return lst;
+    }();
+    static_assert(digits.front() == 0 && digits.back() == 9);
+    std::cout << "constexpr sorted: "s << digits << " in "s << sizeof(digits) << " bytes\n"s;
+
+    {
+      // The assign, front and back sections with tracked elements: the
+      // counts at the end show element constructions and no allocations
+      tracking_scope scope { "static_list"sv };
+      static_list<tchar, 8> characters;
+
+      characters.assign(5, 'a');
+      std::cout << "assign(5, 'a'):    "s << characters << '\n';
+      std::string const extra(6, 'b');
+      characters.assign(extra.begin(), extra.end());
+      std::cout << "assign(range):     "s << characters << '\n';
+      characters.assign({ 'C', '+', '+', '1', '1', });
+      std::cout << "assign({ ... }):   "s << characters << '\n';
+
+      static_list<tchar, 8> letters { 'o', 'm', 'g', 'w', 't', 'f', };
+      std::cout << "front: '"s << letters.front() << "', back: '"s << letters.back() << "'\n"s;
+    }
+    {
+      // The pop_back section
+      tracking_scope scope { "static_list"sv };
+      static_list<tracked<int>, 3> numbers;
+      std::cout << "pop_back:          "s << numbers;
+      for (auto nr : { 5, 3, 4, }) {
+        numbers.push_back(nr);
+      }
+      std::cout << " -> "s << numbers;
+      numbers.pop_back();
+      std::cout << " -> "s << numbers;
+      try {
+        numbers.push_back(1);
+        numbers.push_back(2);
+      }
+      catch (std::length_error const & ex) {
+        std::cout << ", then "s << ex.what();
+      }
+      std::cout << '\n';
+    }
+
+    std::cout << '\n';
+  }
+
+  /// clst::compact_list
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "clst::compact_list - 32-bit links and stable handles"s << '\n';
+  {
+    using namespace clst;
+
+    // The std::C_list section again, with a handle kept to the 16
+    compact_list<int> lst { 7, 5, 16, 8, };
+    auto const sixteen = lst.handle_of(std::find(lst.begin(), lst.end(), 16));
+    lst.push_front(25);
+    lst.push_back(13);
+    lst.insert(lst.iterator_to(sixteen), 42);
+    std::cout << "list:   "s << lst << '\n';
+
+    // Sorting and splicing relink slots, so the handle still finds its element
+    lst.sort();
+    lst.splice(lst.begin(), lst, lst.iterator_to(sixteen), lst.end());
+    std::cout << "sorted, tail from 16 spliced to the front: "s << lst
+              << ", handle -> "s << *lst.iterator_to(sixteen) << '\n';
+    // A std::list<int> node is two pointers and the int, padded to pointer alignment
+    struct list_node { void * prev; void * next; int value; };
+    std::cout << "bytes per node: "s << sizeof(int) + compact_list<int>::link_bytes
+              << " (std::list<int>: "s << sizeof(list_node) << " before the allocator's header)\n"s;
+
+    std::cout << '\n';
+  }
+
+  /// clst::append_range, clst::assign_range, clst::resize
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "clst::assign_range, append_range, resize - one run of nodes per batch"s << '\n';
+  {
+    using namespace clst;
+
+    // The assign and resize sections on a pooled_list: each batch's nodes are
+    // adjacent blocks of one slab, visited in address order
+    node_pool<std::string> pool;
+    pooled_list<std::string> words { pool_allocator<std::string>(pool) };
+    auto adjacent = [&pool](auto const & lst) {
+      return std::adjacent_find(lst.begin(), lst.end(), [&pool](auto const & lhs, auto const & rhs) {
+        return reinterpret_cast<char const *>(&rhs) - reinterpret_cast<char const *>(&lhs)
+            != static_cast<std::ptrdiff_t>(pool.block_size());
+      }) == lst.end();
+    };
+
+    std::vector<std::string> const words1 { "the"s, "frogurt"s, "is"s, "also"s, "cursed"s, };
+    assign_range(words, words1);
+    std::cout << "assign_range:  "s << words << (adjacent(words) ? ", adjacent"s : ""s) << '\n';
+    resize(words, 8, "Mo"s);
+    std::cout << "resize(8, Mo): "s << words << '\n';
+    append_range(words, words1 | std::views::take(2));
+    std::cout << "append_range:  "s << words << '\n';
+    std::cout << "nodes: "s << pool.stats().allocations << ", slabs: "s << pool.stats().chunks << '\n';
+
+    std::cout << '\n';
+  }
+
+  /// clst::views
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "clst::views - filter, transform, dedup_adjacent, take, generator"s << '\n';
+  {
+    using namespace clst;
+
+    // One pass over words1 and one new list, where a copy followed by
+    // remove_if and unique would build and unlink a whole copy first.
+    std::list<std::string> const words1 { "the"s, "frogurt"s, "is"s, "is"s, "also"s, "cursed"s, "cursed"s, };
+    auto shout = [](std::string word) {
+      std::transform(word.begin(), word.end(), word.begin(), [](unsigned char ch) { return std::toupper(ch); });
+      return word;
+    };
+    auto const loud = words1
+                    | views::filter([](std::string const & word) { return word.size() > 2; })
+                    | views::transform(shout)
+                    | views::dedup_adjacent
+                    | to<std::list<std::string>>();
+    std::cout << "words1:   "s << words1 << '\n';
+    std::cout << "pipeline: "s << loud << '\n';
+
+    // A coroutine source: the squares are computed only as far as take asks.
+    auto squares = []() -> generator<int> {
+      for (int nr = 1; ; ++nr) {
+        co_yield nr * nr;
+      }
+    };
+    auto const odd_squares = squares()
+                           | views::filter([](int val) { return val % 2 != 0; })
+                           | views::take(5)
+                           | to<std::list<int>>();
+    std::cout << "odd squares: "s << odd_squares << '\n';
+
+    // Into pooled nodes: a sized pipeline is appended as one run of blocks.
+    node_pool<int> pool;
+    auto const tens = odd_squares
+                    | views::transform([](int val) { return val * 10; })
+                    | to<pooled_list<int>>(pool_allocator<int>(pool));
+    std::cout << "pooled:      "s << tens << ", runs: "s << pool.stats().runs << '\n';
+
+    std::cout << '\n';
+  }
+
+  /// clst::compact
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "clst::compact - node locality after churn, prefetched"s << '\n';
+  {
+    using namespace clst;
+
+    node_pool<int> pool;
+    pooled_list<int> nums { pool_allocator<int>(pool) };
+    auto in_order = [&pool](auto const & lst) {
+      return std::adjacent_find(lst.begin(), lst.end(), [&pool](auto const & lhs, auto const & rhs) {
+        return reinterpret_cast<char const *>(&rhs) - reinterpret_cast<char const *>(&lhs)
+            != static_cast<std::ptrdiff_t>(pool.block_size());
+      }) == lst.end();
+    };
+
+    // Sorting relinks the nodes where they lie; erasing leaves holes.
+    append_range(nums, std::vector<int> { 8, 7, 5, 9, 0, 1, 3, 2, 6, 4, });
+    nums.sort();
+    nums.remove_if([](int val) { return val % 3 == 0; });
+    std::cout << "churned:   "s << nums << (in_order(nums) ? ", in memory order"s : ", scattered"s) << '\n';
+
+    // A few nodes per step, as a background task would with run_for().
+    list_compactor<int, int> compactor { nums, 2 };
+    auto steps = 1;
+    while (compactor.step()) {
+      ++steps;
+    }
+    std::cout << "compacted: "s << nums << (in_order(nums) ? ", in memory order"s : ", scattered"s)
+              << " ("s << steps << " steps)\n"s;
+
+    auto const ahead = prefetched(nums, 2);
+    std::cout << "sum, prefetching 2 ahead: "s << std::accumulate(ahead.begin(), ahead.end(), 0) << '\n';
+
+    std::cout << '\n';
+  }
+
+  /// clst::tracking
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "clst::tracking - allocations, copies and moves by section"s << '\n';
+  {
+    clst::tracking::report(std::cout);
+
+    std::cout << '\n';
+  }
+
+  if (latency_arg != argv + argc) {
+    /// clst::latency
+    // ....+....!....+....!....+....!....+....!....+....!....+....!
+    std::cout << konst::dot << '\n';
+    std::cout << "clst::latency - list operation latencies (ns) by section"s << '\n';
+    {
+      if (std::string_view(*latency_arg) == "--latency=json"sv) {
+        clst::latency::write_json(std::cout);
+      }
+      else {
+        clst::latency::report(std::cout);
+      }
+
+      std::cout << '\n';
+    }
+  }
+
   std::cout << std::endl; //  make sure cout is flushed.
 
   return 0;
@@ -0,0 +1,97 @@
+//
+//  lru_cache.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: https://en.wikipedia.org/wiki/Cache_replacement_policies#LRU
+//  @see: https://en.cppreference.com/w/cpp/container/list/splice
+//
+
+#ifndef lru_cache_hpp
+#define lru_cache_hpp
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+#include "indexed_list.hpp"
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst
+namespace clst {
+
+/*
+ *  MARK: lru_cache
+ *  Least-recently-used cache of at most capacity() entries, kept in an
+ *  indexed_list ordered from most to least recently used.  A hit is one hash
+ *  lookup and one splice to the front; a miss that fills the cache evicts the
+ *  back element.  Nothing is copied or reallocated on a hit.
+ */
+template<typename K, typename V, typename Hash = std::hash<K>, typename Eq = std::equal_to<K>>
+class lru_cache {
+public:
+  using key_type = K;
+  using mapped_type = V;
+  using size_type = std::size_t;
+
+  struct stats {
+    std::size_t hits = 0;
+    std::size_t misses = 0;
+    std::size_t evictions = 0;
+  };
+
+  explicit lru_cache(size_type capacity) : capacity_ { capacity == 0 ? 1 : capacity } {
+    entries_.reserve(capacity_);
+  }
+
+  auto size() const noexcept -> size_type { return entries_.size(); }
+  auto capacity() const noexcept -> size_type { return capacity_; }
+  auto statistics() const noexcept -> stats const & { return stats_; }
+
+  //  Whether key is cached; does not count as a use.
+  auto contains(K const & key) const -> bool { return entries_.contains(key); }
+
+  //  The cached value for key, now the most recently used, or nullptr.
+  auto get(K const & key) -> V * {
+    auto const it = entries_.find(key);
+    if (it == entries_.end()) {
+      ++stats_.misses;
+      return nullptr;
+    }
+    ++stats_.hits;
+    entries_.move_to_front(it);
+    return &it->second;
+  }
+
+  //  Cache value under key as the most recently used entry, replacing any
+  //  value already there and evicting the least recently used if full.
+  auto put(K key, V value) -> V & {
+    if (auto const it = entries_.find(key); it != entries_.end()) {
+      it->second = std::move(value);
+      entries_.move_to_front(it);
+      return it->second;
+    }
+    if (entries_.size() == capacity_) {
+      entries_.pop_back();
+      ++stats_.evictions;
+    }
+    return entries_.push_front(std::move(key), std::move(value)).first->second;
+  }
+
+  auto erase(K const & key) -> bool { return entries_.erase(key) != 0; }
+  auto clear() noexcept -> void { entries_.clear(); }
+
+  //  Most recently used first.
+  auto begin() const noexcept { return entries_.begin(); }
+  auto end() const noexcept { return entries_.end(); }
+
+private:
+  size_type capacity_;
+  indexed_list<K, V, Hash, Eq> entries_;
+  stats stats_;
+};
+
+} /* namespace clst */
+
+#endif /* lru_cache_hpp */
@@ -0,0 +1,468 @@
+//
+//  mapped_list.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: https://pubs.opengroup.org/onlinepubs/9699919799/functions/mmap.html
+//  @see: https://pubs.opengroup.org/onlinepubs/9699919799/functions/msync.html
+//
+
+#ifndef mapped_list_hpp
+#define mapped_list_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <cerrno>
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst
+namespace clst {
+
+/*
+ *  MARK: mapped_list
+ *  A doubly linked list of trivially copyable T whose nodes live in a file
+ *  mapped into memory.  Nodes link to each other by their index in the file,
+ *  not by address, so a later process - or the same one after a restart - can
+ *  reopen the file and walk the list at once, with nothing to parse or rebuild.
+ *
+ *  Every insert and erase first writes what it is about to do to a one-entry
+ *  journal in the file header, marks the entry valid, does it, then clears
+ *  the journal.  Opening a file whose journal is not clear finishes the
+ *  operation, so a crash at any point leaves either the old list or the new
+ *  one.  With sync_each_op (the default) each of those steps is also flushed
+ *  with msync, which makes this hold across a power failure too, at the price
+ *  of four flushes per operation; without it, call sync() at the points that
+ *  should survive one.
+ *
+ *  Erased nodes go on a free list and are reused before the file grows.
+ *  Growing remaps the file, which moves every element: iterators stay valid
+ *  (they hold node indices), pointers and references into the list do not.
+ *  The file stores sizeof(T) and alignof(T) and is only reopened as the same T,
+ *  on a machine with the same byte order.
+ */
+template<typename T>
+class mapped_list {
+  static_assert(std::is_trivially_copyable_v<T>, "clst::mapped_list stores T as raw bytes");
+
+  using index = std::uint64_t;  // node 0 is the sentinel of the circular list
+
+  struct node {
+    index next;
+    index prev;
+    T value;
+  };
+
+  enum class op : std::uint64_t { none, insert, erase, clear, };
+
+  //  A redo record: applying it twice is the same as applying it once.
+  struct journal {
+    op what;
+    index nd;
+    index prev;
+    index next;
+    index free_link;  // erase: the free list the node is pushed onto
+    std::uint64_t size;
+    index free_head;
+    index bump;
+  };
+
+  struct header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t value_size;
+    std::uint32_t value_align;
+    std::uint32_t node_size;
+    std::uint64_t capacity;   // nodes the file has room for
+    std::uint64_t size;
+    index free_head;          // 0 when no erased node is waiting for reuse
+    index bump;               // first node never used
+    journal pending;
+  };
+
+  static constexpr char file_magic[8] = { 'C', 'L', 'S', 'T', 'M', 'A', 'P', '\0', };
+  static constexpr std::uint32_t file_version = 1;
+
+  //  The journal's copy of the value being inserted follows the header.
+  static constexpr std::size_t value_offset = (sizeof(header) + alignof(T) - 1) / alignof(T) * alignof(T);
+
+  static auto page_size() -> std::size_t { return static_cast<std::size_t>(::sysconf(_SC_PAGESIZE)); }
+  static auto header_bytes() -> std::size_t {
+    auto const page = page_size();
+    return (value_offset + sizeof(T) + page - 1) / page * page;
+  }
+
+  class const_iterator_type {
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T const *;
+    using reference = T const &;
+
+    const_iterator_type() noexcept = default;
+
+    auto operator*() const -> reference { return list_->at(ix_).value; }
+    auto operator->() const -> pointer { return &list_->at(ix_).value; }
+
+    auto operator++() -> const_iterator_type & { ix_ = list_->at(ix_).next; return *this; }
+    auto operator++(int) -> const_iterator_type { auto tmp = *this; ++*this; return tmp; }
+    auto operator--() -> const_iterator_type & { ix_ = list_->at(ix_).prev; return *this; }
+    auto operator--(int) -> const_iterator_type { auto tmp = *this; --*this; return tmp; }
+
+    friend auto operator==(const_iterator_type const & lhs, const_iterator_type const & rhs) -> bool {
+      return lhs.ix_ == rhs.ix_;
+    }
+
+  private:
+    friend class mapped_list;
+
+    const_iterator_type(mapped_list const * list, index ix) noexcept : list_ { list }, ix_ { ix } {}
+
+    mapped_list const * list_ = nullptr;
+    index ix_ = 0;
+  };
+
+public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using const_reference = T const &;
+  using iterator = const_iterator_type;
+  using const_iterator = const_iterator_type;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  //  Open the list stored at path, creating the file if there is none.
+  //  Throws std::system_error if it cannot be opened or mapped, and
+  //  std::runtime_error if it holds something other than a mapped_list<T>.
+  explicit mapped_list(std::filesystem::path path, size_type initial_capacity = 1024, bool sync_each_op = true)
+    : path_ { std::move(path) }, sync_each_op_ { sync_each_op } {
+    fd_ = ::open(path_.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd_ < 0) {
+      fail("open");
+    }
+    struct stat st {};
+    if (::fstat(fd_, &st) != 0) {
+      close();
+      fail("fstat");
+    }
+    try {
+      if (st.st_size == 0) {
+        create(std::max<size_type>(initial_capacity, 1) + 1);
+      }
+      else {
+        open_existing(static_cast<std::size_t>(st.st_size));
+      }
+    }
+    catch (...) {
+      close();
+      throw;
+    }
+  }
+
+  mapped_list(mapped_list const &) = delete;
+  mapped_list & operator=(mapped_list const &) = delete;
+
+  mapped_list(mapped_list && other) noexcept
+    : path_ { std::move(other.path_) }, fd_ { std::exchange(other.fd_, -1) },
+      base_ { std::exchange(other.base_, nullptr) }, bytes_ { std::exchange(other.bytes_, 0) },
+      sync_each_op_ { other.sync_each_op_ } {}
+
+  auto operator=(mapped_list && other) noexcept -> mapped_list & {
+    if (this != &other) {
+      close();
+      path_ = std::move(other.path_);
+      fd_ = std::exchange(other.fd_, -1);
+      base_ = std::exchange(other.base_, nullptr);
+      bytes_ = std::exchange(other.bytes_, 0);
+      sync_each_op_ = other.sync_each_op_;
+    }
+    return *this;
+  }
+
+  ~mapped_list() { close(); }
+
+  auto path() const -> std::filesystem::path const & { return path_; }
+
+  //  MARK: Element access
+  auto front() const -> const_reference { return at(at(0).next).value; }
+  auto back() const -> const_reference { return at(at(0).prev).value; }
+
+  //  MARK: Iterators
+  auto begin() const noexcept -> const_iterator { return const_iterator(this, at(0).next); }
+  auto cbegin() const noexcept -> const_iterator { return begin(); }
+  auto end() const noexcept -> const_iterator { return const_iterator(this, 0); }
+  auto cend() const noexcept -> const_iterator { return end(); }
+  auto rbegin() const noexcept -> const_reverse_iterator { return const_reverse_iterator(end()); }
+  auto rend() const noexcept -> const_reverse_iterator { return const_reverse_iterator(begin()); }
+
+  //  MARK: Capacity
+  [[nodiscard]] auto empty() const noexcept -> bool { return hdr().size == 0; }
+  auto size() const noexcept -> size_type { return static_cast<size_type>(hdr().size); }
+  //  Elements the file holds before it has to grow.
+  auto capacity() const noexcept -> size_type { return static_cast<size_type>(hdr().capacity - 1); }
+
+  //  Grow the file now so that 'count' elements fit without remapping.
+  auto reserve(size_type count) -> void {
+    if (count + 1 > hdr().capacity) {
+      grow(count + 1);
+    }
+  }
+
+  //  MARK: Modifiers
+  auto insert(const_iterator pos, T const & value) -> iterator {
+    T const val = value;  // 'value' may be an element, which growing unmaps.
+    if (hdr().free_head == 0 && hdr().bump == hdr().capacity) {
+      grow(hdr().capacity * 2);
+    }
+    auto & hd = hdr();
+    journal jr {};
+    jr.what = op::insert;
+    if (hd.free_head != 0) {
+      jr.nd = hd.free_head;
+      jr.free_head = at(hd.free_head).next;
+      jr.bump = hd.bump;
+    }
+    else {
+      jr.nd = hd.bump;
+      jr.free_head = 0;
+      jr.bump = hd.bump + 1;
+    }
+    jr.next = pos.ix_;
+    jr.prev = at(pos.ix_).prev;
+    jr.size = hd.size + 1;
+    std::memcpy(base_ + value_offset, &val, sizeof(T));
+    commit(jr);
+    return iterator(this, jr.nd);
+  }
+
+  auto push_back(T const & value) -> void { insert(end(), value); }
+  auto push_front(T const & value) -> void { insert(begin(), value); }
+
+  auto erase(const_iterator pos) -> iterator {
+    auto & hd = hdr();
+    auto const & nd = at(pos.ix_);
+    journal jr {};
+    jr.what = op::erase;
+    jr.nd = pos.ix_;
+    jr.prev = nd.prev;
+    jr.next = nd.next;
+    jr.free_link = hd.free_head;
+    jr.size = hd.size - 1;
+    jr.free_head = pos.ix_;
+    jr.bump = hd.bump;
+    commit(jr);
+    return iterator(this, jr.next);
+  }
+
+  auto pop_front() -> void { erase(begin()); }
+  auto pop_back() -> void { erase(std::prev(end())); }
+
+  //  Empty the list and recycle every node; the file keeps its size.
+  auto clear() -> void {
+    journal jr {};
+    jr.what = op::clear;
+    jr.bump = 1;
+    commit(jr);
+  }
+
+  //  Flush everything written so far to the file.
+  auto sync() -> void {
+    if (::msync(base_, bytes_, MS_SYNC) != 0) {
+      fail("msync");
+    }
+  }
+
+private:
+  [[noreturn]] auto fail(char const * what) const -> void {
+    throw std::system_error(errno, std::generic_category(), std::string("clst::mapped_list: ") + what + ' ' + path_.string());
+  }
+
+  auto hdr() const noexcept -> header & { return *reinterpret_cast<header *>(base_); }
+
+  auto at(index ix) const noexcept -> node & {
+    return *reinterpret_cast<node *>(base_ + header_bytes() + ix * sizeof(node));
+  }
+
+  auto file_bytes(index nodes) const -> std::size_t { return header_bytes() + nodes * sizeof(node); }
+
+  auto map(std::size_t bytes) -> void {
+    auto * addr = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (addr == MAP_FAILED) {
+      fail("mmap");
+    }
+    base_ = static_cast<std::byte *>(addr);
+    bytes_ = bytes;
+  }
+
+  auto create(index nodes) -> void {
+    if (::ftruncate(fd_, static_cast<off_t>(file_bytes(nodes))) != 0) {
+      fail("ftruncate");
+    }
+    if (base_ == nullptr) {
+      map(file_bytes(nodes));
+    }
+    auto & hd = hdr();
+    hd = header {};
+    hd.version = file_version;
+    hd.value_size = sizeof(T);
+    hd.value_align = alignof(T);
+    hd.node_size = sizeof(node);
+    hd.capacity = nodes;
+    hd.bump = 1;
+    at(0).next = 0;
+    at(0).prev = 0;
+    flush(base_, bytes_);
+    //  The magic goes in last: a file without it is not a list yet.
+    std::memcpy(hd.magic, file_magic, sizeof(file_magic));
+    flush(base_, sizeof(header));
+  }
+
+  auto open_existing(std::size_t bytes) -> void {
+    if (bytes < header_bytes()) {
+      throw std::runtime_error("clst::mapped_list: not a list file: " + path_.string());
+    }
+    map(bytes);
+    auto const & hd = hdr();
+    constexpr char unset[sizeof(file_magic)] = {};
+    if (std::memcmp(hd.magic, unset, sizeof(unset)) == 0 && bytes >= file_bytes(2)) {
+      //  Created, but the process stopped before the header was complete.
+      create((bytes - header_bytes()) / sizeof(node));
+      return;
+    }
+    if (std::memcmp(hd.magic, file_magic, sizeof(file_magic)) != 0 || hd.version != file_version) {
+      throw std::runtime_error("clst::mapped_list: not a list file: " + path_.string());
+    }
+    if (hd.value_size != sizeof(T) || hd.value_align != alignof(T) || hd.node_size != sizeof(node)
+        || file_bytes(hd.capacity) > bytes) {
+      throw std::runtime_error("clst::mapped_list: file holds a different element type: " + path_.string());
+    }
+    if (hd.pending.what != op::none) {
+      apply(hd.pending);
+      finish();
+    }
+  }
+
+  auto close() noexcept -> void {
+    if (base_ != nullptr) {
+      ::munmap(base_, bytes_);
+      base_ = nullptr;
+      bytes_ = 0;
+    }
+    if (fd_ >= 0) {
+      ::close(fd_);
+      fd_ = -1;
+    }
+  }
+
+  //  Extend the file to 'nodes' nodes and map it again.  The header's
+  //  capacity changes only once the file is that long, so a crash in between
+  //  leaves a longer file with the same list in it.
+  auto grow(index nodes) -> void {
+    if (::ftruncate(fd_, static_cast<off_t>(file_bytes(nodes))) != 0) {
+      fail("ftruncate");
+    }
+    ::munmap(base_, bytes_);
+    base_ = nullptr;
+    map(file_bytes(nodes));
+    hdr().capacity = nodes;
+    flush(base_, sizeof(header));
+  }
+
+  //  Record jr, carry it out, then mark it done, flushing between the steps.
+  //  The record is written with 'what' still none and flushed, and only then
+  //  is 'what' stored: a crash part way through the copy leaves a record that
+  //  recovery ignores, never one with stale fields behind a valid 'what'.
+  auto commit(journal const & jr) -> void {
+    auto & pending = hdr().pending;
+    auto body = jr;
+    body.what = op::none;
+    pending = body;
+    flush(base_, header_bytes());
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+    pending.what = jr.what;
+    flush(base_, sizeof(header));
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+    apply(jr);
+    finish();
+  }
+
+  auto finish() -> void {
+    hdr().pending.what = op::none;
+    flush(base_, sizeof(header));
+  }
+
+  auto apply(journal const & jr) -> void {
+    auto & hd = hdr();
+    switch (jr.what) {
+      case op::insert: {
+        auto & nd = at(jr.nd);
+        std::memcpy(&nd.value, base_ + value_offset, sizeof(T));
+        nd.next = jr.next;
+        nd.prev = jr.prev;
+        at(jr.prev).next = jr.nd;
+        at(jr.next).prev = jr.nd;
+        flush_node(jr.nd);
+        break;
+      }
+      case op::erase:
+        at(jr.prev).next = jr.next;
+        at(jr.next).prev = jr.prev;
+        at(jr.nd).next = jr.free_link;
+        flush_node(jr.nd);
+        break;
+      case op::clear:
+        at(0).next = 0;
+        at(0).prev = 0;
+        break;
+      case op::none:
+        return;
+    }
+    flush_node(jr.prev);
+    flush_node(jr.next);
+    hd.size = jr.size;
+    hd.free_head = jr.free_head;
+    hd.bump = jr.bump;
+  }
+
+  auto flush_node(index ix) -> void { flush(&at(ix), sizeof(node)); }
+
+  //  msync the pages holding [addr, addr + len) when syncing every operation.
+  auto flush(void const * addr, std::size_t len) -> void {
+    if (!sync_each_op_) {
+      return;
+    }
+    auto const page = page_size();
+    auto const first = reinterpret_cast<std::uintptr_t>(addr) / page * page;
+    auto const last = reinterpret_cast<std::uintptr_t>(addr) + len;
+    if (::msync(reinterpret_cast<void *>(first), last - first, MS_SYNC) != 0) {
+      fail("msync");
+    }
+  }
+
+  std::filesystem::path path_;
+  int fd_ = -1;
+  std::byte * base_ = nullptr;
+  std::size_t bytes_ = 0;
+  bool sync_each_op_ = true;
+};
+
+} /* namespace clst */
+
+#endif /* mapped_list_hpp */
@@ -0,0 +1,306 @@
+//
+//  node_pool.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: https://en.cppreference.com/w/cpp/named_req/Allocator
+//  @see: https://en.cppreference.com/w/cpp/memory/allocator_traits
+//
+
+#ifndef node_pool_hpp
+#define node_pool_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <list>
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <type_traits>
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst
+namespace clst {
+
+/*
+ *  MARK: pool_stats
+ *  Counters kept by a node_pool.  'chunks' is the number of trips to the global
+ *  allocator; 'allocations' is the number of nodes handed out.
+ */
+struct pool_stats {
+  std::size_t chunks = 0;         // calls to ::operator new for slabs
+  std::size_t chunk_bytes = 0;    // bytes obtained from ::operator new
+  std::size_t allocations = 0;    // nodes handed out
+  std::size_t deallocations = 0;  // nodes given back
+  std::size_t reused = 0;         // allocations satisfied from the free list
+  std::size_t fallbacks = 0;      // requests the pool could not serve
+  std::size_t runs = 0;           // slabs taken for runs set up by reserve()
+  std::size_t trimmed = 0;        // slabs given back by trim()
+  std::size_t trimmed_bytes = 0;  // bytes given back by trim()
+
+  auto live() const -> std::size_t { return allocations - deallocations; }
+  auto held_bytes() const -> std::size_t { return chunk_bytes - trimmed_bytes; }
+};
+
+/*
+ *  MARK: node_pool
+ *  Fixed-size block arena for the nodes of a container of T.
+ *
+ *  The block size is taken from the first request (a std::list only ever asks
+ *  for single nodes), blocks are carved from slabs that double in size up to
+ *  max_chunk_nodes, and freed blocks go onto an intrusive free list for reuse.
+ *  Requests of any other size or count fall through to ::operator new.
+ *
+ *  reserve(n) makes the next n node allocations bypass the free list and come
+ *  from one run of adjacent blocks, in the order they are requested, so a
+ *  batch of nodes is laid out in the order the list links them.
+ *
+ *  A pool is not synchronised; like the container it serves it must not be used
+ *  from two threads at once.  Slabs are returned by the destructor, and by
+ *  trim() once none of their blocks is in use.
+ */
+template<typename T>
+class node_pool {
+public:
+  static constexpr std::size_t initial_chunk_nodes = 64;
+  static constexpr std::size_t max_chunk_nodes = 64 * 1024;
+
+  node_pool() = default;
+  explicit node_pool(std::size_t first_chunk_nodes)
+    : next_chunk_nodes_ { std::max<std::size_t>(first_chunk_nodes, 1) } {}
+
+  node_pool(node_pool const &) = delete;
+  node_pool & operator=(node_pool const &) = delete;
+
+  ~node_pool() {
+    for (auto & ck : chunks_) {
+      ::operator delete(ck.base, std::align_val_t { chunk_align });
+    }
+  }
+
+  auto allocate(std::size_t bytes, std::size_t align) -> void * {
+    if (block_size_ == 0 && align <= chunk_align) {
+      node_bytes_ = bytes;
+      block_size_ = round_up(std::max(bytes, sizeof(free_block)),
+                             std::max(align, alignof(free_block)));
+    }
+    if (bytes != node_bytes_ || align > chunk_align) {
+      ++stats_.fallbacks;
+      return ::operator new(bytes, std::align_val_t { std::max(align, alignof(std::max_align_t)) });
+    }
+
+    ++stats_.allocations;
+    if (reserved_ != 0) {
+      if (static_cast<std::size_t>(bump_end_ - bump_) < reserved_ * block_size_) {
+        grow(reserved_);
+        ++stats_.runs;
+      }
+      --reserved_;
+      auto * blk = bump_;
+      bump_ += block_size_;
+      return blk;
+    }
+    if (free_ != nullptr) {
+      ++stats_.reused;
+      auto * blk = free_;
+      free_ = blk->next;
+      return blk;
+    }
+    if (bump_ == bump_end_) {
+      grow();
+    }
+    auto * blk = bump_;
+    bump_ += block_size_;
+    return blk;
+  }
+
+  auto deallocate(void * ptr, std::size_t bytes, std::size_t align) noexcept -> void {
+    if (bytes != node_bytes_ || align > chunk_align) {
+      ::operator delete(ptr, std::align_val_t { std::max(align, alignof(std::max_align_t)) });
+      return;
+    }
+    ++stats_.deallocations;
+    auto * blk = static_cast<free_block *>(ptr);
+    blk->next = free_;
+    free_ = blk;
+  }
+
+  //  The next 'nodes' node allocations are carved, in order, from one run of
+  //  adjacent blocks; a fresh slab is taken for the run if the current one
+  //  has too little left.  reserve(0) cancels what is left of a reservation.
+  auto reserve(std::size_t nodes) noexcept -> void { reserved_ = nodes; }
+
+  //  Give back every slab none of whose blocks is in use, dropping its blocks
+  //  from the free list; returns the bytes released.  O(free blocks x log
+  //  slabs).  Releases nothing if its scratch space cannot be allocated.
+  auto trim() noexcept -> std::size_t {
+    if (chunks_.empty()) {
+      return 0;
+    }
+    std::vector<std::size_t> order;
+    std::vector<std::size_t> unused;
+    try {
+      order.resize(chunks_.size());
+      unused.resize(chunks_.size());
+    }
+    catch (...) {
+      return 0;
+    }
+    std::iota(order.begin(), order.end(), std::size_t { 0 });
+    std::sort(order.begin(), order.end(), [this](auto lhs, auto rhs) { return chunks_[lhs].base < chunks_[rhs].base; });
+    auto owner = [&](void const * ptr) {
+      auto const at = std::upper_bound(order.begin(), order.end(), static_cast<std::byte const *>(ptr),
+                                       [this](std::byte const * addr, std::size_t ix) { return addr < chunks_[ix].base; });
+      return *std::prev(at);
+    };
+
+    for (auto * blk = free_; blk != nullptr; blk = blk->next) {
+      ++unused[owner(blk)];
+    }
+    if (bump_ != bump_end_) {
+      unused[owner(bump_)] += static_cast<std::size_t>(bump_end_ - bump_) / block_size_;
+    }
+    auto empty = [&](std::size_t ix) { return unused[ix] == chunks_[ix].bytes / block_size_; };
+
+    std::size_t released = 0;
+    std::size_t kept_free = 0;
+    for (std::size_t ix = 0; ix != chunks_.size(); ++ix) {
+      released += empty(ix) ? chunks_[ix].bytes : 0;
+      kept_free += empty(ix) ? 0 : unused[ix];
+    }
+    if (released == 0) {
+      return 0;
+    }
+
+    //  Unless every free block is going, relink the ones that stay.
+    auto ** tail = &free_;
+    if (bump_ != bump_end_ && !empty(owner(bump_))) {
+      kept_free -= static_cast<std::size_t>(bump_end_ - bump_) / block_size_;
+    }
+    for (auto * blk = free_; kept_free != 0; blk = blk->next) {
+      if (!empty(owner(blk))) {
+        *tail = blk;
+        tail = &blk->next;
+        --kept_free;
+      }
+    }
+    *tail = nullptr;
+    if (bump_ != nullptr && empty(owner(bump_ == bump_end_ ? bump_ - 1 : bump_))) {
+      bump_ = bump_end_ = nullptr;
+    }
+
+    std::size_t kept = 0;
+    for (std::size_t ix = 0; ix != chunks_.size(); ++ix) {
+      if (empty(ix)) {
+        ::operator delete(chunks_[ix].base, std::align_val_t { chunk_align });
+        ++stats_.trimmed;
+      }
+      else {
+        chunks_[kept++] = chunks_[ix];
+      }
+    }
+    chunks_.resize(kept);
+    stats_.trimmed_bytes += released;
+    return released;
+  }
+
+  auto stats() const -> pool_stats const & { return stats_; }
+  auto block_size() const -> std::size_t { return block_size_; }
+
+  //  The process-wide pool used by default-constructed pool_allocators.  It is
+  //  intentionally leaked so that static lists can outlive it safely.
+  static auto shared() -> node_pool & {
+    static auto * pool = new node_pool;
+    return *pool;
+  }
+
+private:
+  static constexpr std::size_t chunk_align = alignof(std::max_align_t);
+
+  struct free_block { free_block * next; };
+  struct chunk { std::byte * base; std::size_t bytes; };
+
+  static constexpr auto round_up(std::size_t val, std::size_t to) -> std::size_t {
+    return (val + to - 1) / to * to;
+  }
+
+  //  A new slab of at least min_nodes blocks; what is left of the current
+  //  one goes onto the free list.
+  auto grow(std::size_t min_nodes = 1) -> void {
+    for (; bump_ != bump_end_; bump_ += block_size_) {
+      free_ = ::new (static_cast<void *>(bump_)) free_block { free_ };
+    }
+    auto const bytes = std::max(next_chunk_nodes_, min_nodes) * block_size_;
+    auto * base = static_cast<std::byte *>(::operator new(bytes, std::align_val_t { chunk_align }));
+    chunks_.push_back(chunk { base, bytes, });
+    bump_ = base;
+    bump_end_ = base + bytes;
+    ++stats_.chunks;
+    stats_.chunk_bytes += bytes;
+    next_chunk_nodes_ = std::min(next_chunk_nodes_ * 2, max_chunk_nodes);
+  }
+
+  std::size_t node_bytes_ = 0;
+  std::size_t block_size_ = 0;
+  std::size_t next_chunk_nodes_ = initial_chunk_nodes;
+  std::size_t reserved_ = 0;
+  free_block * free_ = nullptr;
+  std::byte * bump_ = nullptr;
+  std::byte * bump_end_ = nullptr;
+  std::vector<chunk> chunks_;
+  pool_stats stats_ {};
+};
+
+/*
+ *  MARK: pool_allocator
+ *  Stateful allocator that draws from a node_pool<E>.  E is carried through
+ *  rebind so the list's node allocator and its value allocator share one pool.
+ *  Moves and swaps carry the pool along; copies keep their own.
+ */
+template<typename T, typename E = T>
+class pool_allocator {
+public:
+  using value_type = T;
+  using pool_type = node_pool<E>;
+  using propagate_on_container_copy_assignment = std::false_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  using is_always_equal = std::false_type;
+
+  pool_allocator() noexcept : pool_ { &pool_type::shared() } {}
+  explicit pool_allocator(pool_type & pool) noexcept : pool_ { &pool } {}
+
+  template<typename U>
+  pool_allocator(pool_allocator<U, E> const & other) noexcept : pool_ { other.pool() } {}
+
+  auto allocate(std::size_t n) -> T * {
+    return static_cast<T *>(pool_->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  auto deallocate(T * ptr, std::size_t n) noexcept -> void {
+    pool_->deallocate(ptr, n * sizeof(T), alignof(T));
+  }
+
+  auto pool() const noexcept -> pool_type * { return pool_; }
+
+  template<typename U>
+  friend auto operator==(pool_allocator const & lhs, pool_allocator<U, E> const & rhs) noexcept -> bool {
+    return lhs.pool() == rhs.pool();
+  }
+
+private:
+  pool_type * pool_;
+};
+
+/*
+ *  MARK: pooled_list
+ *  std::list whose nodes come from a node_pool<T>.
+ */
+template<typename T>
+using pooled_list = std::list<T, pool_allocator<T>>;
+
+} /* namespace clst */
+
+#endif /* node_pool_hpp */
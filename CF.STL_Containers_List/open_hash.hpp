@@ -0,0 +1,194 @@
+//
+//  open_hash.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: https://en.wikipedia.org/wiki/Open_addressing
+//  @see: https://en.wikipedia.org/wiki/Linear_probing#Deletion
+//
+
+#ifndef open_hash_hpp
+#define open_hash_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <utility>
+#include <vector>
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst
+namespace clst {
+
+namespace detail {
+
+//  Spread the bits of a hash: std::hash of an integer is often the integer,
+//  which would cluster badly under a power-of-two mask.
+constexpr auto mix_hash(std::size_t hash) noexcept -> std::size_t {
+  std::uint64_t hv = hash;
+  hv ^= hv >> 33;
+  hv *= 0xff51afd7ed558ccdull;
+  hv ^= hv >> 33;
+  return static_cast<std::size_t>(hv);
+}
+
+} /* namespace detail */
+
+/*
+ *  MARK: open_index
+ *  Open-addressing hash index over entries that carry their own key, such as
+ *  list iterators or pointers.  KeyOf maps an entry to its key; the index
+ *  stores only the entry and its hash, never a copy of the key.
+ *
+ *  Linear probing in a power-of-two table kept at most 3/4 full; erase shifts
+ *  the following entries back instead of leaving tombstones, so lookups never
+ *  slow down as entries come and go.
+ */
+template<typename Entry, typename Key, typename KeyOf, typename Hash = std::hash<Key>, typename Eq = std::equal_to<Key>>
+class open_index {
+  struct slot {
+    std::size_t hash = 0;  // 0 marks an empty slot
+    Entry entry {};
+  };
+
+public:
+  explicit open_index(KeyOf key_of = KeyOf(), Hash hash = Hash(), Eq eq = Eq())
+    : key_of_ { std::move(key_of) }, hash_ { std::move(hash) }, eq_ { std::move(eq) } {}
+
+  open_index(open_index const &) = default;
+  auto operator=(open_index const &) -> open_index & = default;
+
+  //  A moved-from index is empty, not merely without slots.
+  open_index(open_index && other) noexcept
+    : slots_ { std::move(other.slots_) }, mask_ { std::exchange(other.mask_, 0) }, size_ { std::exchange(other.size_, 0) },
+      key_of_ { std::move(other.key_of_) }, hash_ { std::move(other.hash_) }, eq_ { std::move(other.eq_) } {
+    other.slots_.clear();
+  }
+
+  auto operator=(open_index && other) noexcept -> open_index & {
+    if (this != &other) {
+      slots_ = std::exchange(other.slots_, {});
+      mask_ = std::exchange(other.mask_, 0);
+      size_ = std::exchange(other.size_, 0);
+      key_of_ = std::move(other.key_of_);
+      hash_ = std::move(other.hash_);
+      eq_ = std::move(other.eq_);
+    }
+    return *this;
+  }
+
+  auto size() const noexcept -> std::size_t { return size_; }
+  [[nodiscard]] auto empty() const noexcept -> bool { return size_ == 0; }
+  auto capacity() const noexcept -> std::size_t { return slots_.size() / 4 * 3; }
+  auto memory_bytes() const noexcept -> std::size_t { return slots_.capacity() * sizeof(slot); }
+
+  //  Make room for 'count' entries without rehashing.
+  auto reserve(std::size_t count) -> void {
+    if (count > capacity()) {
+      rehash(std::max<std::size_t>(16, std::bit_ceil((count * 4 + 2) / 3)));
+    }
+  }
+
+  auto clear() noexcept -> void {
+    for (auto & sl : slots_) {
+      sl = slot {};
+    }
+    size_ = 0;
+  }
+
+  auto hash_of(Key const & key) const -> std::size_t {
+    auto const hv = detail::mix_hash(hash_(key));
+    return hv == 0 ? 1 : hv;
+  }
+
+  auto find(Key const & key) const -> Entry const * { return find(key, hash_of(key)); }
+
+  //  Lookup with a hash from hash_of(), for callers that probe and then insert.
+  auto find(Key const & key, std::size_t hash) const -> Entry const * {
+    if (size_ == 0) {
+      return nullptr;
+    }
+    for (auto ix = hash & mask_; slots_[ix].hash != 0; ix = (ix + 1) & mask_) {
+      if (slots_[ix].hash == hash && eq_(key_of_(slots_[ix].entry), key)) {
+        return &slots_[ix].entry;
+      }
+    }
+    return nullptr;
+  }
+
+  //  Add an entry whose key is not yet present.
+  auto insert(Entry entry) -> void {
+    auto const hash = hash_of(key_of_(entry));
+    insert(std::move(entry), hash);
+  }
+
+  auto insert(Entry entry, std::size_t hash) -> void {
+    if (size_ + 1 > capacity()) {
+      rehash(slots_.empty() ? 16 : slots_.size() * 2);
+    }
+    place(std::move(entry), hash);
+    ++size_;
+  }
+
+  //  Remove the entry with this key; returns whether there was one.
+  auto erase(Key const & key) -> bool {
+    if (size_ == 0) {
+      return false;
+    }
+    auto const hash = hash_of(key);
+    auto ix = hash & mask_;
+    for (; slots_[ix].hash != 0; ix = (ix + 1) & mask_) {
+      if (slots_[ix].hash == hash && eq_(key_of_(slots_[ix].entry), key)) {
+        break;
+      }
+    }
+    if (slots_[ix].hash == 0) {
+      return false;
+    }
+    //  Backward shift: pull up every later entry of the run that may move into
+    //  the hole without passing its home slot.
+    for (auto nx = (ix + 1) & mask_; slots_[nx].hash != 0; nx = (nx + 1) & mask_) {
+      auto const home = slots_[nx].hash & mask_;
+      if (((nx - home) & mask_) >= ((nx - ix) & mask_)) {
+        slots_[ix] = std::move(slots_[nx]);
+        ix = nx;
+      }
+    }
+    slots_[ix] = slot {};
+    --size_;
+    return true;
+  }
+
+private:
+  auto place(Entry entry, std::size_t hash) -> void {
+    auto ix = hash & mask_;
+    while (slots_[ix].hash != 0) {
+      ix = (ix + 1) & mask_;
+    }
+    slots_[ix] = slot { hash, std::move(entry), };
+  }
+
+  auto rehash(std::size_t count) -> void {
+    auto old = std::exchange(slots_, std::vector<slot>(count));
+    mask_ = count - 1;
+    for (auto & sl : old) {
+      if (sl.hash != 0) {
+        place(std::move(sl.entry), sl.hash);
+      }
+    }
+  }
+
+  std::vector<slot> slots_;
+  std::size_t mask_ = 0;
+  std::size_t size_ = 0;
+  [[no_unique_address]] KeyOf key_of_;
+  [[no_unique_address]] Hash hash_;
+  [[no_unique_address]] Eq eq_;
+};
+
+} /* namespace clst */
+
+#endif /* open_hash_hpp */
@@ -0,0 +1,225 @@
+//
+//  parallel_algorithms.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: https://en.cppreference.com/w/cpp/algorithm/transform_reduce
+//  @see: https://en.cppreference.com/w/cpp/algorithm/execution_policy_tag_t
+//
+
+#ifndef parallel_algorithms_hpp
+#define parallel_algorithms_hpp
+
+#include <cstddef>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "thread_pool.hpp"
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst::par
+namespace clst::par {
+
+/*
+ *  MARK: segments
+ *  A list cut into parts of equal length, kept as the iterators at the cuts.
+ *  std::execution::par cannot split a bidirectional range without walking
+ *  it, so the cuts are found in one walk and the parts then run on a pool.
+ *  Harvesting the cuts costs one pointer chase over the list, which for a
+ *  cheap per-element operation is as much as the operation itself: keep the
+ *  segments and pass them to every algorithm until the list changes shape.
+ *  Any insert or erase that touches a cut invalidates them.
+ */
+template<typename It>
+class segments {
+public:
+  segments() = default;
+
+  segments(It first, std::size_t count, std::size_t parts) {
+    parts = std::clamp<std::size_t>(parts, 1, std::max<std::size_t>(count, 1));
+    cuts_.reserve(parts + 1);
+    cuts_.push_back(first);
+    for (std::size_t ix = 1; ix <= parts; ++ix) {
+      std::advance(first, static_cast<std::ptrdiff_t>(count * ix / parts - count * (ix - 1) / parts));
+      cuts_.push_back(first);
+    }
+  }
+
+  auto size() const noexcept -> std::size_t { return cuts_.empty() ? 0 : cuts_.size() - 1; }
+  auto first(std::size_t ix) const -> It { return cuts_[ix]; }
+  auto last(std::size_t ix) const -> It { return cuts_[ix + 1]; }
+
+private:
+  std::vector<It> cuts_;
+};
+
+//  Parts worth running apart: up to four per worker, none under min_segment.
+inline auto segment_count(thread_pool const & pool, std::size_t count, std::size_t min_segment = 4'096)
+    -> std::size_t {
+  if (pool.size() < 2) {
+    return 1;
+  }
+  return std::clamp<std::size_t>(count / std::max<std::size_t>(min_segment, 1), 1, pool.size() * 4);
+}
+
+template<typename List>
+auto make_segments(List & lst, std::size_t parts) -> segments<decltype(lst.begin())> {
+  return segments<decltype(lst.begin())>(lst.begin(), lst.size(), parts);
+}
+
+template<typename List>
+auto make_segments(thread_pool const & pool, List & lst) -> segments<decltype(lst.begin())> {
+  return make_segments(lst, segment_count(pool, lst.size()));
+}
+
+namespace detail {
+
+template<typename T>
+inline constexpr bool is_segments = false;
+template<typename It>
+inline constexpr bool is_segments<segments<It>> = true;
+
+//  A list to be cut up, as opposed to segments already cut.
+template<typename T>
+concept whole_list = !is_segments<std::remove_cvref_t<T>>;
+
+//  Run fn(ix) for every part, on the pool when there is more than one.
+template<typename Fn>
+auto each_part(thread_pool & pool, std::size_t parts, Fn & fn) -> void {
+  if (parts == 1) {
+    fn(std::size_t { 0 });
+    return;
+  }
+  task_group group { pool };
+  for (std::size_t ix = 0; ix < parts; ++ix) {
+    group.run([&fn, ix]() { fn(ix); });
+  }
+  group.wait();
+}
+
+} /* namespace detail */
+
+/*
+ *  MARK: for_each()
+ *  fn is called concurrently from several threads, on distinct elements.
+ */
+template<typename It, typename Fn>
+auto for_each(thread_pool & pool, segments<It> const & segs, Fn fn) -> void {
+  auto part = [&segs, &fn](std::size_t ix) { std::for_each(segs.first(ix), segs.last(ix), fn); };
+  detail::each_part(pool, segs.size(), part);
+}
+
+template<typename List, typename Fn>
+  requires detail::whole_list<List>
+auto for_each(thread_pool & pool, List & lst, Fn fn) -> void {
+  for_each(pool, make_segments(pool, lst), std::move(fn));
+}
+
+/*
+ *  MARK: transform_reduce()
+ *  Each part is reduced on its own, starting from its first transformed
+ *  element; the partial results are then folded into init in list order on
+ *  the calling thread.  reduce must be associative, not commutative, and
+ *  the result is the same from run to run for the same number of parts.
+ */
+template<typename It, typename T, typename Reduce, typename Transform>
+auto transform_reduce(thread_pool & pool, segments<It> const & segs, T init, Reduce reduce, Transform transform) -> T {
+  std::vector<std::optional<T>> partial(segs.size());
+  auto part = [&](std::size_t ix) {
+    auto first = segs.first(ix);
+    auto const last = segs.last(ix);
+    if (first == last) {
+      return;
+    }
+    T acc = transform(*first);
+    for (++first; first != last; ++first) {
+      acc = reduce(std::move(acc), transform(*first));
+    }
+    partial[ix].emplace(std::move(acc));
+  };
+  detail::each_part(pool, segs.size(), part);
+  for (auto & res : partial) {
+    if (res) {
+      init = reduce(std::move(init), std::move(*res));
+    }
+  }
+  return init;
+}
+
+template<typename List, typename T, typename Reduce, typename Transform>
+  requires detail::whole_list<List>
+auto transform_reduce(thread_pool & pool, List & lst, T init, Reduce reduce, Transform transform) -> T {
+  return transform_reduce(pool, make_segments(pool, lst), std::move(init), std::move(reduce), std::move(transform));
+}
+
+/*
+ *  MARK: count_if()
+ */
+template<typename It, typename Pred>
+auto count_if(thread_pool & pool, segments<It> const & segs, Pred pred) -> std::size_t {
+  std::vector<std::size_t> partial(segs.size());
+  auto part = [&](std::size_t ix) {
+    partial[ix] = static_cast<std::size_t>(std::count_if(segs.first(ix), segs.last(ix), pred));
+  };
+  detail::each_part(pool, segs.size(), part);
+  return std::accumulate(partial.begin(), partial.end(), std::size_t { 0 });
+}
+
+template<typename List, typename Pred>
+  requires detail::whole_list<List>
+auto count_if(thread_pool & pool, List & lst, Pred pred) -> std::size_t {
+  return count_if(pool, make_segments(pool, lst), std::move(pred));
+}
+
+/*
+ *  MARK: remove_if()
+ *  pred is evaluated on the pool, each part collecting the nodes to drop;
+ *  the nodes are then erased on the calling thread, in list order, so the
+ *  list's allocator is never called from two threads.  Returns the number
+ *  erased, like std::list::remove_if.  A list too short to split, or a pool
+ *  of one thread, is filtered in a single pass with nothing collected.
+ */
+template<typename List, typename Pred>
+auto remove_if(thread_pool & pool, List & lst, Pred pred) -> typename List::size_type {
+  typename List::size_type erased = 0;
+  if (segment_count(pool, lst.size()) == 1) {
+    for (auto it = lst.begin(); it != lst.end();) {
+      if (pred(*it)) {
+        it = lst.erase(it);
+        ++erased;
+      }
+      else {
+        ++it;
+      }
+    }
+    return erased;
+  }
+  auto const segs = make_segments(pool, lst);
+  std::vector<std::vector<decltype(lst.begin())>> doomed(segs.size());
+  auto part = [&](std::size_t ix) {
+    for (auto it = segs.first(ix); it != segs.last(ix); ++it) {
+      if (pred(*it)) {
+        doomed[ix].push_back(it);
+      }
+    }
+  };
+  detail::each_part(pool, segs.size(), part);
+  for (auto const & its : doomed) {
+    for (auto it : its) {
+      lst.erase(it);
+      ++erased;
+    }
+  }
+  return erased;
+}
+
+} /* namespace clst::par */
+
+#endif /* parallel_algorithms_hpp */
@@ -0,0 +1,104 @@
+//
+//  parallel_sort.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: https://en.cppreference.com/w/cpp/container/list/splice
+//  @see: https://en.cppreference.com/w/cpp/container/list/merge
+//
+
+#ifndef parallel_sort_hpp
+#define parallel_sort_hpp
+
+#include <cstddef>
+#include <algorithm>
+#include <list>
+#include <vector>
+#include <iterator>
+#include <functional>
+#include <thread>
+
+#include "thread_pool.hpp"
+#include "fast_sort.hpp"
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst
+namespace clst {
+
+/*
+ *  MARK: parallel_sort()
+ *  Stable multi-threaded sort of a std::list.
+ *
+ *  The list is cut into runs of consecutive nodes with splice, each run is
+ *  sorted on the pool with fast_sort, and neighbouring runs are merged pairwise
+ *  (left.merge(right), so ties keep their original order) in parallel rounds
+ *  until one run remains, which is spliced back.  Only node links change:
+ *  iterators and references stay valid, as with std::list::sort.
+ *  Lists shorter than min_run per thread are sorted on the calling thread.
+ *  If comp throws, the list keeps all of its elements, in unspecified order.
+ */
+template<typename T, typename A, typename Compare = std::less<>>
+auto parallel_sort(std::list<T, A> & lst, Compare comp, thread_pool & pool,
+                   std::size_t min_run = 4'096) -> void {
+  using list_type = std::list<T, A>;
+
+  auto const count = lst.size();
+  auto runs = std::min(pool.size() * 4, count / std::max<std::size_t>(min_run, 1));
+  if (pool.size() < 2 || runs < 2) {
+    fast_sort(lst, comp);
+    return;
+  }
+
+  std::vector<list_type> parts;
+  parts.reserve(runs);
+  for (std::size_t rn = 0; rn < runs; ++rn) {
+    parts.emplace_back(lst.get_allocator());
+    auto const take = (rn + 1 == runs) ? lst.size() : count / runs;
+    auto last = std::next(lst.begin(), static_cast<std::ptrdiff_t>(take));
+    parts.back().splice(parts.back().end(), lst, lst.begin(), last);
+  }
+
+  //  A throwing comparison leaves every element in one of the parts, as
+  //  fast_sort and merge keep theirs; put them all back before rethrowing.
+  try {
+    {
+      task_group group { pool };
+      for (auto & part : parts) {
+        group.run([&part, &comp]() { fast_sort(part, comp); });
+      }
+      group.wait();
+    }
+
+    for (std::size_t stride = 1; stride < parts.size(); stride *= 2) {
+      task_group group { pool };
+      for (std::size_t ix = 0; ix + stride < parts.size(); ix += 2 * stride) {
+        group.run([&parts, &comp, ix, stride]() { parts[ix].merge(parts[ix + stride], comp); });
+      }
+      group.wait();
+    }
+  }
+  catch (...) {
+    for (auto & part : parts) {
+      lst.splice(lst.end(), part);
+    }
+    throw;
+  }
+
+  lst.splice(lst.end(), parts.front());
+}
+
+template<typename T, typename A, typename Compare = std::less<>>
+auto parallel_sort(std::list<T, A> & lst, Compare comp = Compare(),
+                   std::size_t threads = std::thread::hardware_concurrency()) -> void {
+  if (threads < 2) {
+    fast_sort(lst, comp);
+    return;
+  }
+  thread_pool pool { threads };
+  parallel_sort(lst, comp, pool);
+}
+
+} /* namespace clst */
+
+#endif /* parallel_sort_hpp */
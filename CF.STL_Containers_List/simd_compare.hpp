@@ -0,0 +1,317 @@
+//
+//  simd_compare.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: https://en.cppreference.com/w/cpp/algorithm/lexicographical_compare_three_way
+//  @see: https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html
+//  @see: https://developer.arm.com/architectures/instruction-sets/intrinsics/
+//
+
+#ifndef simd_compare_hpp
+#define simd_compare_hpp
+
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(__AVX__) || defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#include "synth_three_way.hpp"
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst
+namespace clst {
+
+//  The instruction set the comparison kernels were compiled for.  The kernel
+//  is picked at compile time, not by probing the CPU at run time: build with
+//  -mavx2 (or -march=native) to get the AVX2 kernels on x86-64.
+constexpr auto simd_isa() noexcept -> std::string_view {
+#if defined(__AVX2__)
+  return "avx2";
+#elif defined(__SSE2__)
+  return "sse2";
+#elif defined(__ARM_NEON)
+  return "neon";
+#else
+  return "scalar";
+#endif
+}
+
+namespace detail {
+
+/*
+ *  MARK: mismatch()
+ *  Index of the first i < n with !(lhs[i] == rhs[i]), or n.
+ *
+ *  Integers compare equal exactly when their bytes do, so they are scanned as
+ *  bytes, four registers of 32 (AVX2) or 16 (SSE2) bytes at a time, or one
+ *  16-byte register at a time with NEON.  float and double use the ordered
+ *  equality compare, which, like ==, is false for NaN and true for -0.0 == 0.0
+ *  (NEON compares double only on AArch64).  Whatever is left, and every other
+ *  type, is compared one element at a time.
+ */
+template<typename T>
+auto mismatch(T const * lhs, T const * rhs, std::size_t n) noexcept -> std::size_t {
+  std::size_t ix = 0;
+
+  if constexpr (std::is_integral_v<T>) {
+    auto const * pl = reinterpret_cast<unsigned char const *>(lhs);
+    auto const * pr = reinterpret_cast<unsigned char const *>(rhs);
+    auto const bytes = n * sizeof(T);
+    std::size_t off = 0;
+#if defined(__AVX2__)
+    //  Four registers per step while everything matches; the single-register
+    //  loop below then pins down the differing lane.
+    for (; off + 128 <= bytes; off += 128) {
+      auto eq = _mm256_set1_epi8(-1);
+      for (std::size_t lane = 0; lane < 128; lane += 32) {
+        eq = _mm256_and_si256(eq, _mm256_cmpeq_epi8(
+            _mm256_loadu_si256(reinterpret_cast<__m256i const *>(pl + off + lane)),
+            _mm256_loadu_si256(reinterpret_cast<__m256i const *>(pr + off + lane))));
+      }
+      if (_mm256_movemask_epi8(eq) != -1) {
+        break;
+      }
+    }
+    for (; off + 32 <= bytes; off += 32) {
+      auto const eq = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<__m256i const *>(pl + off)),
+                                        _mm256_loadu_si256(reinterpret_cast<__m256i const *>(pr + off)));
+      if (auto const ne = ~static_cast<unsigned>(_mm256_movemask_epi8(eq))) {
+        return (off + static_cast<std::size_t>(std::countr_zero(ne))) / sizeof(T);
+      }
+    }
+#endif
+#if defined(__SSE2__)
+    for (; off + 64 <= bytes; off += 64) {
+      auto eq = _mm_set1_epi8(-1);
+      for (std::size_t lane = 0; lane < 64; lane += 16) {
+        eq = _mm_and_si128(eq, _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const *>(pl + off + lane)),
+                                              _mm_loadu_si128(reinterpret_cast<__m128i const *>(pr + off + lane))));
+      }
+      if (_mm_movemask_epi8(eq) != 0xffff) {
+        break;
+      }
+    }
+    for (; off + 16 <= bytes; off += 16) {
+      auto const eq = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const *>(pl + off)),
+                                     _mm_loadu_si128(reinterpret_cast<__m128i const *>(pr + off)));
+      if (auto const ne = ~static_cast<unsigned>(_mm_movemask_epi8(eq)) & 0xffffu) {
+        return (off + static_cast<std::size_t>(std::countr_zero(ne))) / sizeof(T);
+      }
+    }
+#endif
+#if defined(__ARM_NEON)
+    //  NEON has no movemask: narrowing each 16-bit pair of lanes by 4 bits
+    //  leaves one nibble per byte lane, so lane k owns bits 4k..4k+3.
+    for (; off + 16 <= bytes; off += 16) {
+      auto const eq = vceqq_u8(vld1q_u8(pl + off), vld1q_u8(pr + off));
+      auto const mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+      if (auto const ne = ~mask) {
+        return (off + static_cast<std::size_t>(std::countr_zero(ne)) / 4) / sizeof(T);
+      }
+    }
+#endif
+    ix = off / sizeof(T);
+  }
+  else if constexpr (std::is_same_v<T, float>) {
+#if defined(__AVX__)
+    for (; ix + 8 <= n; ix += 8) {
+      auto const eq = _mm256_cmp_ps(_mm256_loadu_ps(lhs + ix), _mm256_loadu_ps(rhs + ix), _CMP_EQ_OQ);
+      if (auto const ne = ~static_cast<unsigned>(_mm256_movemask_ps(eq)) & 0xffu) {
+        return ix + static_cast<std::size_t>(std::countr_zero(ne));
+      }
+    }
+#endif
+#if defined(__SSE2__)
+    for (; ix + 4 <= n; ix += 4) {
+      auto const eq = _mm_cmpeq_ps(_mm_loadu_ps(lhs + ix), _mm_loadu_ps(rhs + ix));
+      if (auto const ne = ~static_cast<unsigned>(_mm_movemask_ps(eq)) & 0xfu) {
+        return ix + static_cast<std::size_t>(std::countr_zero(ne));
+      }
+    }
+#endif
+#if defined(__ARM_NEON)
+    for (; ix + 4 <= n; ix += 4) {
+      auto const eq = vceqq_f32(vld1q_f32(lhs + ix), vld1q_f32(rhs + ix));
+      auto const mask = vget_lane_u64(vreinterpret_u64_u16(vmovn_u32(eq)), 0);
+      if (auto const ne = ~mask) {
+        return ix + static_cast<std::size_t>(std::countr_zero(ne)) / 16;
+      }
+    }
+#endif
+  }
+  else if constexpr (std::is_same_v<T, double>) {
+#if defined(__AVX__)
+    for (; ix + 4 <= n; ix += 4) {
+      auto const eq = _mm256_cmp_pd(_mm256_loadu_pd(lhs + ix), _mm256_loadu_pd(rhs + ix), _CMP_EQ_OQ);
+      if (auto const ne = ~static_cast<unsigned>(_mm256_movemask_pd(eq)) & 0xfu) {
+        return ix + static_cast<std::size_t>(std::countr_zero(ne));
+      }
+    }
+#endif
+#if defined(__SSE2__)
+    for (; ix + 2 <= n; ix += 2) {
+      auto const eq = _mm_cmpeq_pd(_mm_loadu_pd(lhs + ix), _mm_loadu_pd(rhs + ix));
+      if (auto const ne = ~static_cast<unsigned>(_mm_movemask_pd(eq)) & 0x3u) {
+        return ix + static_cast<std::size_t>(std::countr_zero(ne));
+      }
+    }
+#endif
+#if defined(__ARM_NEON) && defined(__aarch64__)
+    for (; ix + 2 <= n; ix += 2) {
+      auto const eq = vceqq_f64(vld1q_f64(lhs + ix), vld1q_f64(rhs + ix));
+      auto const mask = vget_lane_u64(vreinterpret_u64_u32(vmovn_u64(eq)), 0);
+      if (auto const ne = ~mask) {
+        return ix + static_cast<std::size_t>(std::countr_zero(ne)) / 32;
+      }
+    }
+#endif
+  }
+
+  for (; ix < n; ++ix) {
+    if (!(lhs[ix] == rhs[ix])) {
+      return ix;
+    }
+  }
+  return n;
+}
+
+//  A contiguous range is a single chunk.
+template<typename T>
+class single_chunk {
+public:
+  explicit single_chunk(std::span<T const> sp) noexcept : sp_ { sp } {}
+  auto done() const noexcept -> bool { return done_; }
+  auto span() const noexcept -> std::span<T const> { return sp_; }
+  auto next() noexcept -> void { done_ = true; }
+
+private:
+  std::span<T const> sp_;
+  bool done_ = false;
+};
+
+template<typename R>
+concept chunked_range = requires (R const & rng) {
+  { rng.chunk_begin().span() } -> std::convertible_to<std::span<typename R::value_type const>>;
+};
+
+template<typename R>
+concept contiguous_sized_range = std::ranges::contiguous_range<R const> && std::ranges::sized_range<R const>;
+
+template<typename R>
+  requires chunked_range<R> || contiguous_sized_range<R>
+using chunk_value_t = std::remove_cv_t<std::ranges::range_value_t<R const>>;
+
+template<typename R>
+auto chunks_of(R const & rng) {
+  if constexpr (chunked_range<R>) {
+    return rng.chunk_begin();
+  }
+  else {
+    return single_chunk<chunk_value_t<R>>(std::span<chunk_value_t<R> const>(std::ranges::data(rng),
+                                                                           std::ranges::size(rng)));
+  }
+}
+
+//  Walk two chunk sequences in step and return pointers to the first pair of
+//  elements that differ, or two nullptrs when either sequence runs out first.
+//  scan(lhs, rhs, n) returns the index of the first difference in a run, or n.
+template<typename T, typename CursorL, typename CursorR, typename Scan>
+auto first_difference(CursorL lcur, CursorR rcur, Scan scan) noexcept -> std::pair<T const *, T const *> {
+  std::span<T const> lsp;
+  std::span<T const> rsp;
+  for (;;) {
+    for (; lsp.empty() && !lcur.done(); lcur.next()) {
+      lsp = lcur.span();
+    }
+    for (; rsp.empty() && !rcur.done(); rcur.next()) {
+      rsp = rcur.span();
+    }
+    if (lsp.empty() || rsp.empty()) {
+      return { nullptr, nullptr, };
+    }
+    auto const run = std::min(lsp.size(), rsp.size());
+    auto const ix = scan(lsp.data(), rsp.data(), run);
+    if (ix != run) {
+      return { lsp.data() + ix, rsp.data() + ix, };
+    }
+    lsp = lsp.subspan(run);
+    rsp = rsp.subspan(run);
+  }
+}
+
+} /* namespace detail */
+
+/*
+ *  MARK: simd_comparable
+ *  Arithmetic elements, stored either contiguously (std::vector, std::array,
+ *  std::span, ...) or in contiguous chunks (clst::unrolled_list).
+ */
+template<typename R>
+concept simd_comparable = (detail::chunked_range<R> || detail::contiguous_sized_range<R>)
+    && std::is_arithmetic_v<detail::chunk_value_t<R>>;
+
+/*
+ *  MARK: equal()
+ *  Same result as lhs == rhs on the std containers: false at once when the
+ *  sizes differ, otherwise the elements are compared a vector register at a
+ *  time.  Either side may be contiguous or chunked.
+ */
+template<simd_comparable L, simd_comparable R>
+  requires std::same_as<detail::chunk_value_t<L>, detail::chunk_value_t<R>>
+auto equal(L const & lhs, R const & rhs) noexcept -> bool {
+  if (std::ranges::size(lhs) != std::ranges::size(rhs)) {
+    return false;
+  }
+  using T = detail::chunk_value_t<L>;
+  //  Only whether a run matches is needed, not where it stops matching, and for
+  //  integers the C library's memcmp answers that at least as fast.
+  auto const scan = [](T const * lrun, T const * rrun, std::size_t n) noexcept -> std::size_t {
+    if constexpr (std::is_integral_v<T>) {
+      return std::memcmp(lrun, rrun, n * sizeof(T)) == 0 ? n : 0;
+    }
+    else {
+      return detail::mismatch(lrun, rrun, n);
+    }
+  };
+  return detail::first_difference<T>(detail::chunks_of(lhs), detail::chunks_of(rhs), scan).first == nullptr;
+}
+
+/*
+ *  MARK: compare_three_way()
+ *  Same result as lhs <=> rhs on the std containers: std::strong_ordering for
+ *  integers, std::partial_ordering for floating point.  The scan for the first
+ *  differing element is vectorised; only that pair is compared with <=>.
+ */
+template<simd_comparable L, simd_comparable R>
+  requires std::same_as<detail::chunk_value_t<L>, detail::chunk_value_t<R>>
+auto compare_three_way(L const & lhs, R const & rhs) noexcept {
+  using T = detail::chunk_value_t<L>;
+  using result = decltype(detail::synth_three_way()(std::declval<T const &>(), std::declval<T const &>()));
+  auto const scan = [](T const * lrun, T const * rrun, std::size_t n) noexcept {
+    return detail::mismatch(lrun, rrun, n);
+  };
+  auto const [lp, rp] = detail::first_difference<T>(detail::chunks_of(lhs), detail::chunks_of(rhs), scan);
+  if (lp != nullptr) {
+    return static_cast<result>(detail::synth_three_way()(*lp, *rp));
+  }
+  return static_cast<result>(std::ranges::size(lhs) <=> std::ranges::size(rhs));
+}
+
+} /* namespace clst */
+
+#endif /* simd_compare_hpp */
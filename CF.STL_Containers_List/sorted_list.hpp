@@ -0,0 +1,571 @@
+//
+//  sorted_list.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: https://en.wikipedia.org/wiki/Skip_list
+//  @see: https://15721.courses.cs.cmu.edu/spring2018/papers/08-oltpindexes1/pugh-skiplists-cacm1990.pdf
+//
+
+#ifndef sorted_list_hpp
+#define sorted_list_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <memory>
+#include <iterator>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <compare>
+#include <functional>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "synth_three_way.hpp"
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst
+namespace clst {
+
+/*
+ *  MARK: sorted_list
+ *  A list kept in Compare order, backed by a skip list: every node is on the
+ *  bottom level, a quarter of them on the next, and so on, so find, insert and
+ *  erase walk down O(log n) levels instead of scanning the list.  Equivalent
+ *  elements are kept, in insertion order, as in std::multiset.
+ *
+ *  Elements are reached through const iterators only: changing one in place
+ *  could break the order.  Iterators stay valid until their element is erased.
+ *
+ *  merge() and unique() relink nodes in one pass without copying elements.
+ */
+template<typename T, typename Compare = std::less<T>>
+class sorted_list {
+  static constexpr std::size_t max_level = 32;
+
+  struct node_base {
+    node_base * prev;
+    node_base ** links;      // links[0 .. height): next node on each level
+    std::uint32_t height;
+  };
+
+  struct node : node_base {
+    template<typename... Args>
+    explicit node(node_base ** links, std::uint32_t height, Args &&... args)
+      : node_base { nullptr, links, height, }, value (std::forward<Args>(args)...) {}
+
+    T value;
+  };
+
+  static auto value_of(node_base const * nb) noexcept -> T const & { return static_cast<node const *>(nb)->value; }
+
+  //  MARK: const_iterator
+  class const_iterator_type {
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T const *;
+    using reference = T const &;
+
+    const_iterator_type() noexcept = default;
+
+    auto operator*() const -> reference { return value_of(nb_); }
+    auto operator->() const -> pointer { return &value_of(nb_); }
+
+    auto operator++() -> const_iterator_type & { nb_ = nb_->links[0]; return *this; }
+    auto operator++(int) -> const_iterator_type { auto tmp = *this; ++*this; return tmp; }
+    auto operator--() -> const_iterator_type & { nb_ = nb_->prev; return *this; }
+    auto operator--(int) -> const_iterator_type { auto tmp = *this; --*this; return tmp; }
+
+    friend auto operator==(const_iterator_type const & lhs, const_iterator_type const & rhs) -> bool {
+      return lhs.nb_ == rhs.nb_;
+    }
+
+  private:
+    friend class sorted_list;
+
+    explicit const_iterator_type(node_base const * nb) noexcept : nb_ { const_cast<node_base *>(nb) } {}
+
+    node_base * nb_ = nullptr;
+  };
+
+public:
+  using value_type = T;
+  using key_type = T;
+  using key_compare = Compare;
+  using value_compare = Compare;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T const &;
+  using const_reference = T const &;
+  using iterator = const_iterator_type;
+  using const_iterator = const_iterator_type;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  //  MARK: construct/copy/destroy
+  sorted_list() : sorted_list(Compare()) {}
+  explicit sorted_list(Compare const & comp) : comp_ { comp } { reset(); }
+
+  //  Input that is already sorted is linked in O(n); anything else is sorted first.
+  template<typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  sorted_list(InputIt first, InputIt last, Compare const & comp = Compare()) : sorted_list(comp) {
+    std::vector<T> vals(first, last);
+    std::stable_sort(vals.begin(), vals.end(), std::ref(comp_));
+    build(std::make_move_iterator(vals.begin()), std::make_move_iterator(vals.end()));
+  }
+
+  sorted_list(std::initializer_list<T> init, Compare const & comp = Compare())
+    : sorted_list(init.begin(), init.end(), comp) {}
+
+  sorted_list(sorted_list const & other) : sorted_list(other.comp_) { build(other.begin(), other.end()); }
+
+  sorted_list(sorted_list && other) noexcept : comp_ { other.comp_ } {
+    reset();
+    steal(other);
+  }
+
+  ~sorted_list() { clear(); }
+
+  auto operator=(sorted_list const & other) -> sorted_list & {
+    if (this != &other) {
+      clear();
+      comp_ = other.comp_;
+      build(other.begin(), other.end());
+    }
+    return *this;
+  }
+
+  auto operator=(sorted_list && other) noexcept -> sorted_list & {
+    if (this != &other) {
+      clear();
+      comp_ = other.comp_;
+      steal(other);
+    }
+    return *this;
+  }
+
+  auto key_comp() const -> key_compare { return comp_; }
+  auto value_comp() const -> value_compare { return comp_; }
+
+  //  MARK: Element access
+  auto front() const -> const_reference { return value_of(head_.links[0]); }
+  auto back() const -> const_reference { return value_of(head_.prev); }
+
+  //  MARK: Iterators
+  auto begin() const noexcept -> const_iterator { return const_iterator(head_.links[0]); }
+  auto cbegin() const noexcept -> const_iterator { return begin(); }
+  auto end() const noexcept -> const_iterator { return const_iterator(&head_); }
+  auto cend() const noexcept -> const_iterator { return end(); }
+  auto rbegin() const noexcept -> const_reverse_iterator { return const_reverse_iterator(end()); }
+  auto crbegin() const noexcept -> const_reverse_iterator { return rbegin(); }
+  auto rend() const noexcept -> const_reverse_iterator { return const_reverse_iterator(begin()); }
+  auto crend() const noexcept -> const_reverse_iterator { return rend(); }
+
+  //  MARK: Capacity
+  [[nodiscard]] auto empty() const noexcept -> bool { return size_ == 0; }
+  auto size() const noexcept -> size_type { return size_; }
+
+  //  MARK: Lookup
+  //  First element not ordered before key.
+  auto lower_bound(T const & key) const -> const_iterator {
+    return const_iterator(descend([&](node_base const * nb) { return comp_(value_of(nb), key); })->links[0]);
+  }
+
+  //  First element ordered after key.
+  auto upper_bound(T const & key) const -> const_iterator {
+    return const_iterator(descend([&](node_base const * nb) { return !comp_(key, value_of(nb)); })->links[0]);
+  }
+
+  auto equal_range(T const & key) const -> std::pair<const_iterator, const_iterator> {
+    return { lower_bound(key), upper_bound(key), };
+  }
+
+  //  First element equivalent to key, or end().
+  auto find(T const & key) const -> const_iterator {
+    auto const it = lower_bound(key);
+    return it != end() && !comp_(key, *it) ? it : end();
+  }
+
+  auto contains(T const & key) const -> bool { return find(key) != end(); }
+
+  auto count(T const & key) const -> size_type {
+    auto const [first, last] = equal_range(key);
+    return static_cast<size_type>(std::distance(first, last));
+  }
+
+  //  MARK: Modifiers
+  auto clear() noexcept -> void {
+    for (auto * nb = head_.links[0]; nb != &head_; ) {
+      auto * nx = nb->links[0];
+      free_node(static_cast<node *>(nb));
+      nb = nx;
+    }
+    reset();
+  }
+
+  //  Insert after any equivalent elements; returns the new element.
+  template<typename... Args>
+  auto emplace(Args &&... args) -> iterator {
+    if constexpr (sizeof...(Args) == 1 && (std::is_same_v<std::remove_cvref_t<Args>, T> && ...)) {
+      return emplace_at(args..., std::forward<Args>(args)...);
+    }
+    else {
+      T value (std::forward<Args>(args)...);
+      return emplace_at(value, std::move(value));
+    }
+  }
+
+  auto insert(T const & value) -> iterator { return emplace(value); }
+  auto insert(T && value) -> iterator { return emplace(std::move(value)); }
+
+  template<typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  auto insert(InputIt first, InputIt last) -> void {
+    for (; first != last; ++first) {
+      emplace(*first);
+    }
+  }
+  auto insert(std::initializer_list<T> init) -> void { insert(init.begin(), init.end()); }
+
+  auto erase(const_iterator pos) -> iterator {
+    auto * nb = pos.nb_;
+    auto const next = iterator(nb->links[0]);
+    std::array<node_base *, max_level> update;
+    auto const & key = value_of(nb);
+    descend([&](node_base const * cur) { return comp_(value_of(cur), key); }, update.data());
+    //  update[] now holds the last node on each level before the first
+    //  equivalent element; step over equivalents that precede this one.
+    for (std::size_t lv = 0; lv < nb->height; ++lv) {
+      while (update[lv]->links[lv] != nb) {
+        update[lv] = update[lv]->links[lv];
+      }
+    }
+    unlink(nb, update.data());
+    free_node(static_cast<node *>(nb));
+    return next;
+  }
+
+  auto erase(const_iterator first, const_iterator last) -> iterator {
+    while (first != last) {
+      first = erase(first);
+    }
+    return last;
+  }
+
+  //  Remove every element equivalent to key; returns how many.
+  auto erase(T const & key) -> size_type {
+    auto const [first, last] = equal_range(key);
+    auto const count = static_cast<size_type>(std::distance(first, last));
+    erase(first, last);
+    return count;
+  }
+
+  auto pop_front() -> void { erase(begin()); }
+  auto pop_back() -> void { erase(std::prev(end())); }
+
+  auto swap(sorted_list & other) noexcept -> void {
+    sorted_list tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+
+  //  MARK: Operations
+  //  Move every element of other into this list, each after the equivalent
+  //  elements already here, as std::list::merge does.  A few elements are
+  //  inserted one at a time; otherwise both lists are walked once and the
+  //  nodes relinked in O(n + m), with no allocation and no copies.  If the
+  //  comparison throws, the elements merged so far are in this list and the
+  //  rest of other stays in other; both are valid sorted lists.
+  auto merge(sorted_list & other) -> void {
+    if (&other == this || other.empty()) {
+      return;
+    }
+    auto const m = other.size_;
+    if (m * static_cast<size_type>(std::bit_width(size_ + 1)) < size_ + m) {
+      std::array<node_base *, max_level> update;
+      std::array<node_base *, max_level> heads;
+      heads.fill(&other.head_);
+      while (!other.empty()) {
+        auto * nb = other.head_.links[0];
+        auto const & key = value_of(nb);
+        descend([&](node_base const * cur) { return !comp_(key, value_of(cur)); }, update.data());
+        other.unlink(nb, heads.data());
+        link(nb, update.data());
+      }
+    }
+    else {
+      auto * lhs = head_.links[0];
+      auto * rhs = other.head_.links[0];
+      auto const total = size_ + m;
+      relinker chain { *this };
+      try {
+        while (lhs != &head_ && rhs != &other.head_) {
+          if (comp_(value_of(rhs), value_of(lhs))) {
+            chain.append(std::exchange(rhs, rhs->links[0]));
+          }
+          else {
+            chain.append(std::exchange(lhs, lhs->links[0]));
+          }
+        }
+      }
+      catch (...) {
+        //  The nodes not yet appended still link only to each other, in
+        //  order: finish this list with the rest of its own and give the
+        //  rest of other back to other.
+        for (; lhs != &head_; ) {
+          chain.append(std::exchange(lhs, lhs->links[0]));
+        }
+        chain.finish();
+        size_type rest = 0;
+        relinker back { other };
+        for (; rhs != &other.head_; ++rest) {
+          back.append(std::exchange(rhs, rhs->links[0]));
+        }
+        back.finish();
+        size_ = total - rest;
+        other.size_ = rest;
+        throw;
+      }
+      for (; lhs != &head_; ) {
+        chain.append(std::exchange(lhs, lhs->links[0]));
+      }
+      for (; rhs != &other.head_; ) {
+        chain.append(std::exchange(rhs, rhs->links[0]));
+      }
+      chain.finish();
+      size_ = total;
+    }
+    other.reset();
+  }
+  auto merge(sorted_list && other) -> void { merge(other); }
+
+  //  Remove all but the first of each run of equivalent elements, in one pass
+  //  over the bottom level.  Returns how many were removed.
+  auto unique() -> size_type {
+    return unique([this](T const & lhs, T const & rhs) { return !comp_(lhs, rhs); });
+  }
+
+  //  As unique(), for a predicate that is true of an element and the one kept before it.
+  template<typename BinaryPredicate>
+  auto unique(BinaryPredicate pred) -> size_type {
+    if (size_ < 2) {
+      return 0;
+    }
+    size_type removed = 0;
+    relinker chain { *this };
+    auto * kept = head_.links[0];
+    auto * nb = kept->links[0];
+    chain.append(kept);
+    while (nb != &head_) {
+      auto * nx = nb->links[0];
+      if (pred(value_of(kept), value_of(nb))) {
+        free_node(static_cast<node *>(nb));
+        ++removed;
+      }
+      else {
+        chain.append(nb);
+        kept = nb;
+      }
+      nb = nx;
+    }
+    chain.finish();
+    size_ -= removed;
+    return removed;
+  }
+
+private:
+  //  Find the place for key, then build the node: a throwing comparison
+  //  leaves nothing to free.
+  template<typename... Args>
+  auto emplace_at(T const & key, Args &&... args) -> iterator {
+    std::array<node_base *, max_level> update;
+    descend([&](node_base const * nb) { return !comp_(key, value_of(nb)); }, update.data());
+    auto * nd = make_node(std::forward<Args>(args)...);
+    link(nd, update.data());
+    return iterator(nd);
+  }
+
+  //  Walk down from the top level, moving right while 'ahead' holds for the
+  //  next node.  Returns the bottom-level node reached; when update is given,
+  //  it receives the node reached on each level.
+  template<typename Ahead>
+  auto descend(Ahead ahead, node_base ** update = nullptr) const -> node_base * {
+    auto * cur = const_cast<node_base *>(&head_);
+    for (auto lv = level_; lv-- > 0; ) {
+      for (auto * nx = cur->links[lv]; nx != &head_ && ahead(nx); nx = cur->links[lv]) {
+        cur = nx;
+      }
+      if (update != nullptr) {
+        update[lv] = cur;
+      }
+    }
+    return cur;
+  }
+
+  //  Link a node after update[lv] on each of its levels.
+  auto link(node_base * nb, node_base ** update) noexcept -> void {
+    if (nb->height > level_) {
+      for (auto lv = level_; lv < nb->height; ++lv) {
+        update[lv] = &head_;
+      }
+      level_ = nb->height;
+    }
+    for (std::size_t lv = 0; lv < nb->height; ++lv) {
+      nb->links[lv] = update[lv]->links[lv];
+      update[lv]->links[lv] = nb;
+    }
+    nb->prev = update[0];
+    nb->links[0]->prev = nb;
+    ++size_;
+  }
+
+  auto unlink(node_base * nb, node_base ** update) noexcept -> void {
+    for (std::size_t lv = 0; lv < nb->height; ++lv) {
+      update[lv]->links[lv] = nb->links[lv];
+    }
+    nb->links[0]->prev = nb->prev;
+    while (level_ > 1 && head_.links[level_ - 1] == &head_) {
+      --level_;
+    }
+    --size_;
+  }
+
+  //  Relinks nodes, appended in order, into every level of the list.
+  class relinker {
+  public:
+    explicit relinker(sorted_list & list) noexcept : list_ { list } { tails_.fill(&list_.head_); }
+
+    auto append(node_base * nb) noexcept -> void {
+      nb->prev = tails_[0];
+      for (std::size_t lv = 0; lv < nb->height; ++lv) {
+        tails_[lv]->links[lv] = nb;
+        tails_[lv] = nb;
+      }
+      top_ = std::max<std::size_t>(top_, nb->height);
+    }
+
+    auto finish() noexcept -> void {
+      for (std::size_t lv = 0; lv < max_level; ++lv) {
+        tails_[lv]->links[lv] = &list_.head_;
+      }
+      list_.head_.prev = tails_[0];
+      list_.level_ = std::max<std::size_t>(top_, 1);
+    }
+
+  private:
+    sorted_list & list_;
+    std::array<node_base *, max_level> tails_;
+    std::size_t top_ = 1;
+  };
+
+  //  Link elements that are already in order.
+  template<typename InputIt>
+  auto build(InputIt first, InputIt last) -> void {
+    relinker chain { *this };
+    try {
+      for (; first != last; ++first) {
+        chain.append(make_node(*first));
+        ++size_;
+      }
+    }
+    catch (...) {
+      chain.finish();
+      clear();
+      throw;
+    }
+    chain.finish();
+  }
+
+  auto reset() noexcept -> void {
+    head_links_.fill(&head_);
+    head_.prev = &head_;
+    level_ = 1;
+    size_ = 0;
+  }
+
+  //  Take other's nodes; the nodes that pointed at other's head now point at ours.
+  auto steal(sorted_list & other) noexcept -> void {
+    if (other.empty()) {
+      return;
+    }
+    std::array<node_base *, max_level> last;
+    other.descend([](node_base const *) { return true; }, last.data());
+    for (std::size_t lv = 0; lv < other.level_; ++lv) {
+      head_links_[lv] = other.head_links_[lv] == &other.head_ ? &head_ : other.head_links_[lv];
+      if (last[lv] != &other.head_) {
+        last[lv]->links[lv] = &head_;
+      }
+    }
+    head_.prev = other.head_.prev;
+    head_links_[0]->prev = &head_;
+    level_ = other.level_;
+    size_ = other.size_;
+    other.reset();
+  }
+
+  //  Height 1 + k with probability 3/4 * (1/4)^k.
+  auto random_height() noexcept -> std::uint32_t {
+    seed_ ^= seed_ << 13;
+    seed_ ^= seed_ >> 7;
+    seed_ ^= seed_ << 17;
+    auto const height = 1 + std::countr_zero(seed_ | (std::uint64_t { 1 } << 62)) / 2;
+    return static_cast<std::uint32_t>(std::min<std::size_t>(height, max_level));
+  }
+
+  static constexpr auto node_bytes(std::size_t height) noexcept -> std::size_t {
+    return sizeof(node) + height * sizeof(node_base *);
+  }
+
+  template<typename... Args>
+  auto make_node(Args &&... args) -> node * {
+    auto const height = random_height();
+    auto * raw = static_cast<std::byte *>(::operator new(node_bytes(height), std::align_val_t { alignof(node) }));
+    try {
+      return ::new (static_cast<void *>(raw))
+        node(reinterpret_cast<node_base **>(raw + sizeof(node)), height, std::forward<Args>(args)...);
+    }
+    catch (...) {
+      ::operator delete(raw, node_bytes(height), std::align_val_t { alignof(node) });
+      throw;
+    }
+  }
+
+  static auto free_node(node * nd) noexcept -> void {
+    auto const height = nd->height;
+    nd->~node();
+    ::operator delete(static_cast<void *>(nd), node_bytes(height), std::align_val_t { alignof(node) });
+  }
+
+  [[no_unique_address]] Compare comp_;
+  std::array<node_base *, max_level> head_links_;
+  node_base head_ { &head_, head_links_.data(), static_cast<std::uint32_t>(max_level), };
+  std::size_t level_ = 1;
+  std::size_t size_ = 0;
+  std::uint64_t seed_ = 0x9e37'79b9'7f4a'7c15ull;
+};
+
+template<typename T, typename C>
+auto operator==(sorted_list<T, C> const & lhs, sorted_list<T, C> const & rhs) -> bool {
+  return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template<typename T, typename C>
+auto operator<=>(sorted_list<T, C> const & lhs, sorted_list<T, C> const & rhs) {
+  return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                                                detail::synth_three_way {});
+}
+
+template<typename T, typename C>
+auto swap(sorted_list<T, C> & lhs, sorted_list<T, C> & rhs) noexcept -> void {
+  lhs.swap(rhs);
+}
+
+} /* namespace clst */
+
+#endif /* sorted_list_hpp */
@@ -0,0 +1,570 @@
+//
+//  static_list.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: https://en.cppreference.com/w/cpp/container/list
+//
+
+#ifndef static_list_hpp
+#define static_list_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <compare>
+
+#include "synth_three_way.hpp"
+#include "index_links.hpp"
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst
+namespace clst {
+
+namespace detail {
+
+//  Smallest unsigned type that can hold 0 .. N, N being the sentinel.
+template<std::size_t N>
+using static_index_t =
+    std::conditional_t<N < UINT8_MAX, std::uint8_t,
+    std::conditional_t<N < UINT16_MAX, std::uint16_t,
+    std::conditional_t<N < UINT32_MAX, std::uint32_t, std::size_t>>>;
+
+} /* namespace detail */
+
+/*
+ *  MARK: static_list
+ *  Doubly linked list of at most N elements with the std::list interface and
+ *  no heap: the nodes are slots of an array inside the list object, linked by
+ *  the smallest index type that fits N.  Everything is constexpr, so a list
+ *  can be built, sorted and read at compile time.
+ *
+ *  Differences from std::list:
+ *  - inserting into a full list throws std::length_error.
+ *  - the elements live in the list object, so splice and merge from another
+ *    static_list move them into this one (O(k), iterators into the source
+ *    are invalidated); splice within one list relinks as std::list does.
+ *  - move construction, move assignment and swap move the elements, O(n).
+ */
+template<typename T, std::size_t N>
+class static_list {
+  static_assert(N > 0, "clst::static_list needs room for at least one element");
+
+  using index_type = detail::static_index_t<N>;
+  static constexpr index_type head = static_cast<index_type>(N);
+
+  struct link {
+    index_type prev = head;
+    index_type next = head;
+  };
+
+  //  Raw room for one T; the list constructs and destroys value itself.
+  //  Trivial elements are held as plain, value-initialized objects instead,
+  //  so that every slot is initialized and a whole list can be the result
+  //  of a constant expression.
+  union raw_slot {
+    constexpr raw_slot() noexcept {}
+    constexpr ~raw_slot() {}
+    T value;
+  };
+  struct plain_slot {
+    T value {};
+  };
+  using slot = std::conditional_t<std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>,
+                                  plain_slot, raw_slot>;
+
+  template<bool Const>
+  class basic_iterator {
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, T const *, T *>;
+    using reference = std::conditional_t<Const, T const &, T &>;
+
+    constexpr basic_iterator() = default;
+    template<bool C = Const, typename = std::enable_if_t<C>>
+    constexpr basic_iterator(basic_iterator<false> const & other) noexcept : lst_ { other.lst_ }, ix_ { other.ix_ } {}
+
+    constexpr auto operator*() const -> reference { return lst_->slots_[ix_].value; }
+    constexpr auto operator->() const -> pointer { return std::addressof(lst_->slots_[ix_].value); }
+
+    constexpr auto operator++() -> basic_iterator & { ix_ = lst_->links_[ix_].next; return *this; }
+    constexpr auto operator++(int) -> basic_iterator { auto tmp = *this; ++*this; return tmp; }
+    constexpr auto operator--() -> basic_iterator & { ix_ = lst_->links_[ix_].prev; return *this; }
+    constexpr auto operator--(int) -> basic_iterator { auto tmp = *this; --*this; return tmp; }
+
+    friend constexpr auto operator==(basic_iterator const & lhs, basic_iterator const & rhs) -> bool {
+      return lhs.lst_ == rhs.lst_ && lhs.ix_ == rhs.ix_;
+    }
+
+  private:
+    friend class static_list;
+    friend class basic_iterator<!Const>;
+
+    constexpr basic_iterator(static_list const * lst, index_type ix) noexcept
+      : lst_ { const_cast<static_list *>(lst) }, ix_ { ix } {}
+
+    static_list * lst_ = nullptr;
+    index_type ix_ = head;
+  };
+
+public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T &;
+  using const_reference = T const &;
+  using pointer = T *;
+  using const_pointer = T const *;
+  using iterator = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  //  MARK: construct/copy/destroy
+  constexpr static_list() noexcept {}
+
+  constexpr explicit static_list(size_type count) { resize(count); }
+  constexpr static_list(size_type count, T const & value) { insert(end(), count, value); }
+
+  template<typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  constexpr static_list(InputIt first, InputIt last) { insert(end(), first, last); }
+
+  constexpr static_list(std::initializer_list<T> init) { insert(end(), init.begin(), init.end()); }
+
+  constexpr static_list(static_list const & other) { insert(end(), other.begin(), other.end()); }
+
+  constexpr static_list(static_list && other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+    insert(end(), std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+    other.clear();
+  }
+
+  constexpr ~static_list() { clear(); }
+
+  constexpr auto operator=(static_list const & other) -> static_list & {
+    if (this != &other) {
+      assign(other.begin(), other.end());
+    }
+    return *this;
+  }
+
+  constexpr auto operator=(static_list && other) -> static_list & {
+    if (this != &other) {
+      assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+      other.clear();
+    }
+    return *this;
+  }
+
+  constexpr auto operator=(std::initializer_list<T> init) -> static_list & {
+    assign(init.begin(), init.end());
+    return *this;
+  }
+
+  //  Assigns over the elements already there, as std::list does, then
+  //  erases or appends the difference.
+  constexpr auto assign(size_type count, T const & value) -> void {
+    auto it = begin();
+    for (; it != end() && count != 0; ++it, --count) {
+      *it = value;
+    }
+    erase(it, end());
+    insert(end(), count, value);
+  }
+
+  template<typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  constexpr auto assign(InputIt first, InputIt last) -> void {
+    auto it = begin();
+    for (; it != end() && first != last; ++it, ++first) {
+      *it = *first;
+    }
+    erase(it, end());
+    insert(end(), first, last);
+  }
+
+  constexpr auto assign(std::initializer_list<T> init) -> void { assign(init.begin(), init.end()); }
+
+  //  MARK: element access
+  constexpr auto front() -> reference { return slots_[links_[head].next].value; }
+  constexpr auto front() const -> const_reference { return slots_[links_[head].next].value; }
+  constexpr auto back() -> reference { return slots_[links_[head].prev].value; }
+  constexpr auto back() const -> const_reference { return slots_[links_[head].prev].value; }
+
+  //  MARK: iterators
+  constexpr auto begin() noexcept -> iterator { return iterator(this, links_[head].next); }
+  constexpr auto begin() const noexcept -> const_iterator { return const_iterator(this, links_[head].next); }
+  constexpr auto cbegin() const noexcept -> const_iterator { return begin(); }
+  constexpr auto end() noexcept -> iterator { return iterator(this, head); }
+  constexpr auto end() const noexcept -> const_iterator { return const_iterator(this, head); }
+  constexpr auto cend() const noexcept -> const_iterator { return end(); }
+  constexpr auto rbegin() noexcept -> reverse_iterator { return reverse_iterator(end()); }
+  constexpr auto rbegin() const noexcept -> const_reverse_iterator { return const_reverse_iterator(end()); }
+  constexpr auto crbegin() const noexcept -> const_reverse_iterator { return rbegin(); }
+  constexpr auto rend() noexcept -> reverse_iterator { return reverse_iterator(begin()); }
+  constexpr auto rend() const noexcept -> const_reverse_iterator { return const_reverse_iterator(begin()); }
+  constexpr auto crend() const noexcept -> const_reverse_iterator { return rend(); }
+
+  //  MARK: capacity
+  [[nodiscard]] constexpr auto empty() const noexcept -> bool { return size_ == 0; }
+  constexpr auto full() const noexcept -> bool { return size_ == N; }
+  constexpr auto size() const noexcept -> size_type { return size_; }
+  static constexpr auto max_size() noexcept -> size_type { return N; }
+  static constexpr auto capacity() noexcept -> size_type { return N; }
+
+  //  MARK: modifiers
+  constexpr auto clear() noexcept -> void {
+    for (auto ix = links_[head].next; ix != head; ix = links_[ix].next) {
+      destroy(ix);
+    }
+    links_[head] = link {};
+    free_ = head;
+    used_ = 0;
+    size_ = 0;
+  }
+
+  constexpr auto insert(const_iterator pos, T const & value) -> iterator { return emplace(pos, value); }
+  constexpr auto insert(const_iterator pos, T && value) -> iterator { return emplace(pos, std::move(value)); }
+
+  constexpr auto insert(const_iterator pos, size_type count, T const & value) -> iterator {
+    if (count > N - size_) {
+      throw std::length_error("clst::static_list: capacity exceeded");
+    }
+    auto ret = iterator(this, pos.ix_);
+    for (size_type ix = 0; ix < count; ++ix) {
+      auto it = emplace(pos, value);
+      if (ix == 0) {
+        ret = it;
+      }
+    }
+    return ret;
+  }
+
+  //  All or nothing: elements inserted before a throw are erased again.
+  template<typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  constexpr auto insert(const_iterator pos, InputIt first, InputIt last) -> iterator {
+    auto ret = iterator(this, pos.ix_);
+    auto inserted = false;
+    try {
+      for (; first != last; ++first) {
+        auto it = emplace(pos, *first);
+        if (!inserted) {
+          ret = it;
+          inserted = true;
+        }
+      }
+    }
+    catch (...) {
+      if (inserted) {
+        erase(ret, pos);
+      }
+      throw;
+    }
+    return ret;
+  }
+
+  constexpr auto insert(const_iterator pos, std::initializer_list<T> init) -> iterator {
+    return insert(pos, init.begin(), init.end());
+  }
+
+  template<typename... Args>
+  constexpr auto emplace(const_iterator pos, Args &&... args) -> iterator {
+    auto const ix = acquire();
+    try {
+      std::construct_at(std::addressof(slots_[ix].value), std::forward<Args>(args)...);
+    }
+    catch (...) {
+      release(ix);
+      throw;
+    }
+    link_before(pos.ix_, ix);
+    ++size_;
+    return iterator(this, ix);
+  }
+
+  constexpr auto erase(const_iterator pos) -> iterator {
+    auto const ix = pos.ix_;
+    auto const next = links_[ix].next;
+    unlink(ix);
+    destroy(ix);
+    release(ix);
+    --size_;
+    return iterator(this, next);
+  }
+
+  constexpr auto erase(const_iterator first, const_iterator last) -> iterator {
+    while (first != last) {
+      first = erase(first);
+    }
+    return iterator(this, last.ix_);
+  }
+
+  constexpr auto push_back(T const & value) -> void { emplace_back(value); }
+  constexpr auto push_back(T && value) -> void { emplace_back(std::move(value)); }
+
+  template<typename... Args>
+  constexpr auto emplace_back(Args &&... args) -> reference { return *emplace(end(), std::forward<Args>(args)...); }
+
+  constexpr auto pop_back() -> void { erase(const_iterator(this, links_[head].prev)); }
+
+  constexpr auto push_front(T const & value) -> void { emplace_front(value); }
+  constexpr auto push_front(T && value) -> void { emplace_front(std::move(value)); }
+
+  template<typename... Args>
+  constexpr auto emplace_front(Args &&... args) -> reference { return *emplace(begin(), std::forward<Args>(args)...); }
+
+  constexpr auto pop_front() -> void { erase(begin()); }
+
+  constexpr auto resize(size_type count) -> void {
+    if (count > N) {
+      throw std::length_error("clst::static_list: capacity exceeded");
+    }
+    while (size_ > count) {
+      pop_back();
+    }
+    while (size_ < count) {
+      emplace_back();
+    }
+  }
+
+  constexpr auto resize(size_type count, T const & value) -> void {
+    if (count > N) {
+      throw std::length_error("clst::static_list: capacity exceeded");
+    }
+    while (size_ > count) {
+      pop_back();
+    }
+    insert(end(), count - size_, value);
+  }
+
+  //  Swaps the common prefix element by element and moves the rest across.
+  constexpr auto swap(static_list & other) -> void {
+    if (this == &other) {
+      return;
+    }
+    auto lhs = begin();
+    auto rhs = other.begin();
+    for (; lhs != end() && rhs != other.end(); ++lhs, ++rhs) {
+      using std::swap;
+      swap(*lhs, *rhs);
+    }
+    if (lhs != end()) {
+      other.insert(other.end(), std::make_move_iterator(lhs), std::make_move_iterator(end()));
+      erase(lhs, end());
+    }
+    else if (rhs != other.end()) {
+      insert(end(), std::make_move_iterator(rhs), std::make_move_iterator(other.end()));
+      other.erase(rhs, other.end());
+    }
+  }
+
+  //  MARK: operations
+  constexpr auto merge(static_list & other) -> void { merge(other, std::less<>()); }
+  constexpr auto merge(static_list && other) -> void { merge(other, std::less<>()); }
+
+  template<typename Compare>
+  constexpr auto merge(static_list && other, Compare comp) -> void { merge(other, comp); }
+
+  template<typename Compare>
+  constexpr auto merge(static_list & other, Compare comp) -> void {
+    if (this == &other) {
+      return;
+    }
+    if (other.size_ > N - size_) {
+      throw std::length_error("clst::static_list: capacity exceeded");
+    }
+    auto it = begin();
+    for (auto & el : other) {
+      while (it != end() && !comp(el, *it)) {
+        ++it;
+      }
+      emplace(it, std::move(el));
+    }
+    other.clear();
+  }
+
+  constexpr auto splice(const_iterator pos, static_list & other) -> void {
+    if (this == &other) {
+      return;
+    }
+    if (other.size_ > N - size_) {
+      throw std::length_error("clst::static_list: capacity exceeded");
+    }
+    insert(pos, std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+    other.clear();
+  }
+  constexpr auto splice(const_iterator pos, static_list && other) -> void { splice(pos, other); }
+
+  constexpr auto splice(const_iterator pos, static_list & other, const_iterator it) -> void {
+    splice(pos, other, it, std::next(it));
+  }
+  constexpr auto splice(const_iterator pos, static_list && other, const_iterator it) -> void {
+    splice(pos, other, it, std::next(it));
+  }
+
+  constexpr auto splice(const_iterator pos, static_list && other, const_iterator first, const_iterator last) -> void {
+    splice(pos, other, first, last);
+  }
+
+  constexpr auto splice(const_iterator pos, static_list & other, const_iterator first, const_iterator last) -> void {
+    if (first == last) {
+      return;
+    }
+    if (this != &other) {
+      if (static_cast<size_type>(std::distance(first, last)) > N - size_) {
+        throw std::length_error("clst::static_list: capacity exceeded");
+      }
+      auto const from = iterator(&other, first.ix_);
+      auto const to = iterator(&other, last.ix_);
+      insert(pos, std::make_move_iterator(from), std::make_move_iterator(to));
+      other.erase(first, last);
+      return;
+    }
+    if (pos == first || pos == last) {
+      return;
+    }
+    //  Relink [first, last) in front of pos.
+    auto const lo = first.ix_;
+    auto const hi = links_[last.ix_].prev;
+    links_[links_[lo].prev].next = last.ix_;
+    links_[last.ix_].prev = links_[lo].prev;
+    auto const at = pos.ix_;
+    links_[lo].prev = links_[at].prev;
+    links_[links_[at].prev].next = lo;
+    links_[hi].next = at;
+    links_[at].prev = hi;
+  }
+
+  constexpr auto remove(T const & value) -> size_type {
+    T const val = value;  // 'value' may refer to an element that gets erased.
+    return remove_if([&val](T const & el) { return el == val; });
+  }
+
+  template<typename UnaryPredicate>
+  constexpr auto remove_if(UnaryPredicate pred) -> size_type {
+    auto const before = size_;
+    for (auto it = cbegin(); it != cend(); ) {
+      it = pred(*it) ? erase(it) : std::next(it);
+    }
+    return before - size_;
+  }
+
+  constexpr auto reverse() noexcept -> void {
+    auto ix = head;
+    do {
+      auto & lk = links_[ix];
+      std::swap(lk.prev, lk.next);
+      ix = lk.prev;
+    } while (ix != head);
+  }
+
+  constexpr auto unique() -> size_type { return unique(std::equal_to<>()); }
+
+  template<typename BinaryPredicate>
+  constexpr auto unique(BinaryPredicate pred) -> size_type {
+    auto const before = size_;
+    if (size_ > 1) {
+      for (auto kept = cbegin(), it = std::next(kept); it != cend(); ) {
+        if (pred(*kept, *it)) {
+          it = erase(it);
+        }
+        else {
+          kept = it++;
+        }
+      }
+    }
+    return before - size_;
+  }
+
+  constexpr auto sort() -> void { sort(std::less<>()); }
+
+  //  Stable merge sort that relinks the slots; elements are not moved.
+  template<typename Compare>
+  constexpr auto sort(Compare comp) -> void {
+    detail::sort_index_links(links_, head, [this, &comp](index_type lhs, index_type rhs) {
+      return comp(slots_[lhs].value, slots_[rhs].value);
+    });
+  }
+
+private:
+  //  A free slot: the last one released, else the next never used one.
+  constexpr auto acquire() -> index_type {
+    if (free_ != head) {
+      auto const ix = free_;
+      free_ = links_[ix].next;
+      return ix;
+    }
+    if (used_ == N) {
+      throw std::length_error("clst::static_list: capacity exceeded");
+    }
+    return used_++;
+  }
+
+  constexpr auto destroy(index_type ix) noexcept -> void {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      std::destroy_at(std::addressof(slots_[ix].value));
+    }
+  }
+
+  constexpr auto release(index_type ix) noexcept -> void {
+    links_[ix].next = free_;
+    free_ = ix;
+  }
+
+  constexpr auto link_before(index_type at, index_type ix) noexcept -> void {
+    auto const prev = links_[at].prev;
+    links_[ix] = link { prev, at, };
+    links_[prev].next = ix;
+    links_[at].prev = ix;
+  }
+
+  constexpr auto unlink(index_type ix) noexcept -> void {
+    links_[links_[ix].prev].next = links_[ix].next;
+    links_[links_[ix].next].prev = links_[ix].prev;
+  }
+
+  link links_[N + 1] {};
+  slot slots_[N];
+  index_type free_ = head;    // released slots, chained through next
+  index_type used_ = 0;       // slots [0, used_) have been handed out
+  index_type size_ = 0;
+};
+
+//  MARK: non-member functions
+template<typename T, std::size_t N>
+constexpr auto operator==(static_list<T, N> const & lhs, static_list<T, N> const & rhs) -> bool {
+  return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template<typename T, std::size_t N>
+constexpr auto operator<=>(static_list<T, N> const & lhs, static_list<T, N> const & rhs) {
+  return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                                                detail::synth_three_way {});
+}
+
+template<typename T, std::size_t N>
+constexpr auto swap(static_list<T, N> & lhs, static_list<T, N> & rhs) -> void {
+  lhs.swap(rhs);
+}
+
+template<typename T, std::size_t N, typename U>
+constexpr auto erase(static_list<T, N> & container, U const & value) -> typename static_list<T, N>::size_type {
+  return container.remove_if([&value](auto const & el) { return el == value; });
+}
+
+template<typename T, std::size_t N, typename Pred>
+constexpr auto erase_if(static_list<T, N> & container, Pred pred) -> typename static_list<T, N>::size_type {
+  return container.remove_if(pred);
+}
+
+} /* namespace clst */
+
+#endif /* static_list_hpp */
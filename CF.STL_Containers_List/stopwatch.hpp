@@ -0,0 +1,59 @@
+//
+//  stopwatch.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: https://en.cppreference.com/w/cpp/chrono/steady_clock
+//
+
+#ifndef stopwatch_hpp
+#define stopwatch_hpp
+
+#include <chrono>
+#include <utility>
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst
+namespace clst {
+
+/*
+ *  MARK: stopwatch
+ *  Minimal steady_clock timer used by the demo comparisons and the benchmarks.
+ */
+class stopwatch {
+public:
+  using clock = std::chrono::steady_clock;
+
+  stopwatch() : start_ { clock::now() } {}
+
+  auto restart() -> void { start_ = clock::now(); }
+
+  auto elapsed() const -> clock::duration { return clock::now() - start_; }
+
+  auto elapsed_ns() const -> double {
+    return std::chrono::duration<double, std::nano>(elapsed()).count();
+  }
+
+  auto elapsed_ms() const -> double {
+    return std::chrono::duration<double, std::milli>(elapsed()).count();
+  }
+
+private:
+  clock::time_point start_;
+};
+
+/*
+ *  MARK: time_ms()
+ *  Run fn once and return the wall time it took in milliseconds.
+ */
+template<typename Fn>
+auto time_ms(Fn && fn) -> double {
+  stopwatch sw;
+  std::forward<Fn>(fn)();
+  return sw.elapsed_ms();
+}
+
+} /* namespace clst */
+
+#endif /* stopwatch_hpp */
@@ -0,0 +1,246 @@
+//
+//  string_arena.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: https://en.wikipedia.org/wiki/String_interning
+//  @see: https://en.cppreference.com/w/cpp/utility/launder
+//
+
+#ifndef string_arena_hpp
+#define string_arena_hpp
+
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+#include <compare>
+#include <functional>
+#include <list>
+#include <memory>
+#include <new>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "open_hash.hpp"
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst
+namespace clst {
+
+class string_arena;
+
+namespace detail {
+
+//  Written in front of the characters of every interned string, which are
+//  followed by a '\0'.
+struct istring_header {
+  std::size_t size;
+};
+
+struct empty_istring {
+  istring_header head { 0 };
+  char nul = '\0';
+};
+
+inline constexpr empty_istring empty_istring_rep {};
+
+} /* namespace detail */
+
+/*
+ *  MARK: istring
+ *  Handle to a string interned in a string_arena: one pointer, to characters
+ *  that stay where they are until the arena is destroyed.  An arena holds one
+ *  copy of each distinct string, so equality and hashing look only at the
+ *  pointer, O(1) whatever the length.  Ordering compares the characters.
+ *
+ *  Only istrings from the same arena may be compared for equality: the same
+ *  text in two arenas is two strings, except the empty string, which all
+ *  arenas share.  Constructing one from text interns it
+ *  in string_arena::shared().
+ */
+class istring {
+public:
+  using size_type = std::size_t;
+
+  istring() noexcept : data_ { &detail::empty_istring_rep.nul } {}
+  istring(std::string_view str);
+  istring(char const * str) : istring(std::string_view(str)) {}
+  istring(std::string const & str) : istring(std::string_view(str)) {}
+
+  auto data() const noexcept -> char const * { return data_; }
+  auto c_str() const noexcept -> char const * { return data_; }
+  auto size() const noexcept -> size_type { return header().size; }
+  [[nodiscard]] auto empty() const noexcept -> bool { return size() == 0; }
+  auto view() const noexcept -> std::string_view { return { data_, size(), }; }
+  auto str() const -> std::string { return std::string(view()); }
+  operator std::string_view () const noexcept { return view(); }
+
+  friend auto operator==(istring lhs, istring rhs) noexcept -> bool { return lhs.data_ == rhs.data_; }
+  friend auto operator<=>(istring lhs, istring rhs) noexcept -> std::strong_ordering {
+    if (lhs.data_ == rhs.data_) {
+      return std::strong_ordering::equal;
+    }
+    return lhs.view() <=> rhs.view();
+  }
+
+  friend auto operator<<(std::ostream & os, istring istr) -> std::ostream & { return os << istr.view(); }
+
+private:
+  friend class string_arena;
+
+  struct adopt {};
+  istring(adopt, char const * data) noexcept : data_ { data } {}
+
+  auto header() const noexcept -> detail::istring_header const & {
+    return *std::launder(reinterpret_cast<detail::istring_header const *>(data_ - sizeof(detail::istring_header)));
+  }
+
+  char const * data_;
+};
+
+/*
+ *  MARK: string_arena
+ *  Append-only store of distinct strings.  Each is written once, after its
+ *  length and before a '\0', into blocks of block_bytes taken from
+ *  ::operator new (a longer string gets a block of its own); an open_index
+ *  over the interned strings finds the copy already held.  Nothing is freed
+ *  before the arena is destroyed, so every istring it has handed out stays
+ *  valid as long as the arena does.
+ *
+ *  An arena is not synchronised: like a node_pool it must not be used from
+ *  two threads at once.
+ */
+class string_arena {
+public:
+  static constexpr std::size_t block_bytes = 64 * 1024;
+
+  string_arena() = default;
+  string_arena(string_arena const &) = delete;
+  string_arena & operator=(string_arena const &) = delete;
+
+  ~string_arena() {
+    for (auto & blk : blocks_) {
+      ::operator delete(blk.base, std::align_val_t { alignof(detail::istring_header) });
+    }
+  }
+
+  //  The arena's copy of str, made on first sight.  Every arena shares one
+  //  empty string, the one a default-constructed istring holds.
+  auto intern(std::string_view str) -> istring {
+    if (str.empty()) {
+      return istring {};
+    }
+    auto const hash = index_.hash_of(str);
+    if (auto const * found = index_.find(str, hash)) {
+      return istring { istring::adopt {}, *found };
+    }
+    auto * data = store(str);
+    index_.insert(data, hash);
+    return istring { istring::adopt {}, data };
+  }
+
+  //  The arena's copy of str, if it has one; the empty istring if not.
+  auto find(std::string_view str) const -> istring {
+    if (str.empty()) {
+      return istring {};
+    }
+    auto const * found = index_.find(str);
+    return found != nullptr ? istring { istring::adopt {}, *found } : istring {};
+  }
+
+  //  Distinct strings held; the shared empty string is not one of them.
+  auto size() const noexcept -> std::size_t { return index_.size(); }
+
+  //  Heap bytes held: the blocks at their full size, and the index.
+  auto memory_bytes() const noexcept -> std::size_t {
+    return block_total_ + blocks_.capacity() * sizeof(block) + index_.memory_bytes();
+  }
+
+  //  The process-wide arena behind istring's converting constructors.  It is
+  //  intentionally leaked so that static istrings can outlive it safely.
+  static auto shared() -> string_arena & {
+    static auto * arena = new string_arena;
+    return *arena;
+  }
+
+private:
+  struct block { std::byte * base; std::size_t bytes; };
+
+  struct key_of {
+    auto operator()(char const * data) const noexcept -> std::string_view {
+      return istring { istring::adopt {}, data }.view();
+    }
+  };
+
+  static constexpr auto round_up(std::size_t val) -> std::size_t {
+    constexpr auto align = alignof(detail::istring_header);
+    return (val + align - 1) / align * align;
+  }
+
+  //  A string of more than a quarter block gets a block of its own and leaves
+  //  the current one to the short strings.
+  auto store(std::string_view str) -> char const * {
+    auto const need = round_up(sizeof(detail::istring_header) + str.size() + 1);
+    std::byte * at = nullptr;
+    if (need > block_bytes / 4) {
+      at = take(need);
+    }
+    else {
+      if (static_cast<std::size_t>(end_ - next_) < need) {
+        next_ = take(block_bytes);
+        end_ = next_ + block_bytes;
+      }
+      at = next_;
+      next_ += need;
+    }
+    auto * head = ::new (static_cast<void *>(at)) detail::istring_header { str.size() };
+    auto * chars = reinterpret_cast<char *>(head + 1);
+    std::memcpy(chars, str.data(), str.size());
+    chars[str.size()] = '\0';
+    return chars;
+  }
+
+  //  Room in blocks_ is made first, so that a failing push_back cannot leak
+  //  the new block.
+  auto take(std::size_t bytes) -> std::byte * {
+    if (blocks_.size() == blocks_.capacity()) {
+      blocks_.reserve(std::max<std::size_t>(blocks_.capacity() * 2, 8));
+    }
+    auto * base = static_cast<std::byte *>(::operator new(bytes, std::align_val_t { alignof(detail::istring_header) }));
+    blocks_.push_back(block { base, bytes, });
+    block_total_ += bytes;
+    return base;
+  }
+
+  std::vector<block> blocks_;
+  std::size_t block_total_ = 0;
+  std::byte * next_ = nullptr;
+  std::byte * end_ = nullptr;
+  open_index<char const *, std::string_view, key_of> index_ {};
+};
+
+inline istring::istring(std::string_view str) : istring(string_arena::shared().intern(str)) {}
+
+/*
+ *  MARK: istring_list
+ *  A list of interned strings: 8 bytes of value per node where std::string
+ *  takes 32, every repeat of a string shares one copy of its characters, and
+ *  == on elements compares pointers.  Sorting still compares characters.
+ */
+template<typename Allocator = std::allocator<istring>>
+using istring_list = std::list<istring, Allocator>;
+
+} /* namespace clst */
+
+//  MARK: namespace std
+template<>
+struct std::hash<clst::istring> {
+  auto operator()(clst::istring istr) const noexcept -> std::size_t {
+    return std::hash<char const *>()(istr.data());
+  }
+};
+
+#endif /* string_arena_hpp */
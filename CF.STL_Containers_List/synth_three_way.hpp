@@ -0,0 +1,41 @@
+//
+//  synth_three_way.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: https://en.cppreference.com/w/cpp/standard_library/synth-three-way
+//
+
+#ifndef synth_three_way_hpp
+#define synth_three_way_hpp
+
+#include <compare>
+#include <concepts>
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst::detail
+namespace clst::detail {
+
+/*
+ *  MARK: synth_three_way
+ *  The exposition-only helper the standard containers use for operator<=>:
+ *  use T's <=> when it has one, otherwise synthesise a weak ordering from <.
+ */
+struct synth_three_way {
+  template<typename T, typename U>
+  constexpr auto operator()(T const & lhs, U const & rhs) const {
+    if constexpr (std::three_way_comparable_with<T, U>) {
+      return lhs <=> rhs;
+    }
+    else {
+      if (lhs < rhs) { return std::weak_ordering::less; }
+      if (rhs < lhs) { return std::weak_ordering::greater; }
+      return std::weak_ordering::equivalent;
+    }
+  }
+};
+
+} /* namespace clst::detail */
+
+#endif /* synth_three_way_hpp */
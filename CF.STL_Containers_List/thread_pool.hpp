@@ -0,0 +1,213 @@
+//
+//  thread_pool.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: https://en.cppreference.com/w/cpp/thread
+//  @see: https://en.wikipedia.org/wiki/Work_stealing
+//
+
+#ifndef thread_pool_hpp
+#define thread_pool_hpp
+
+#include <cstddef>
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <utility>
+#include <vector>
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst
+namespace clst {
+
+/*
+ *  MARK: thread_pool
+ *  Fixed set of workers, each with its own task deque.  A worker pops its own
+ *  newest task first and, when idle, steals the oldest task of another worker,
+ *  so recursively spawned work stays local until someone runs dry.
+ *  Work is submitted through a task_group, whose wait() helps run tasks.
+ */
+class thread_pool {
+public:
+  using task = std::function<void()>;
+
+  explicit thread_pool(std::size_t threads = std::thread::hardware_concurrency())
+    : queues_(threads == 0 ? 1 : threads) {
+    for (std::size_t ix = 0; ix < queues_.size(); ++ix) {
+      workers_.emplace_back([this, ix]() { work(ix); });
+    }
+  }
+
+  thread_pool(thread_pool const &) = delete;
+  thread_pool & operator=(thread_pool const &) = delete;
+
+  ~thread_pool() {
+    {
+      std::lock_guard<std::mutex> lock { sleep_mtx_ };
+      stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto & th : workers_) {
+      th.join();
+    }
+  }
+
+  auto size() const noexcept -> std::size_t { return queues_.size(); }
+
+  //  Queue a task: onto the calling worker's own deque, or round-robin when
+  //  called from outside the pool.
+  auto push(task tk) -> void {
+    auto const ix = (current_pool() == this) ? current_index() : next_.fetch_add(1) % queues_.size();
+    {
+      std::lock_guard<std::mutex> lock { queues_[ix].mtx };
+      queues_[ix].tasks.push_back(std::move(tk));
+    }
+    {
+      std::lock_guard<std::mutex> lock { sleep_mtx_ };
+      ++queued_;
+    }
+    wake_.notify_one();
+  }
+
+  //  Run one queued task on the calling thread, if there is one.
+  auto try_run_one() -> bool {
+    auto const home = (current_pool() == this) ? current_index() : 0;
+    if (auto tk = take(home)) {
+      (*tk)();
+      return true;
+    }
+    return false;
+  }
+
+private:
+  struct queue {
+    std::mutex mtx;
+    std::deque<task> tasks;
+  };
+
+  static auto current_pool() -> thread_pool *& {
+    thread_local thread_pool * pool = nullptr;
+    return pool;
+  }
+
+  static auto current_index() -> std::size_t & {
+    thread_local std::size_t index = 0;
+    return index;
+  }
+
+  auto take(std::size_t home) -> std::unique_ptr<task> {
+    {
+      auto & own = queues_[home];
+      std::lock_guard<std::mutex> lock { own.mtx };
+      if (!own.tasks.empty()) {
+        auto tk = std::make_unique<task>(std::move(own.tasks.back()));
+        own.tasks.pop_back();
+        claimed();
+        return tk;
+      }
+    }
+    for (std::size_t off = 1; off < queues_.size(); ++off) {
+      auto & victim = queues_[(home + off) % queues_.size()];
+      std::lock_guard<std::mutex> lock { victim.mtx };
+      if (!victim.tasks.empty()) {
+        auto tk = std::make_unique<task>(std::move(victim.tasks.front()));
+        victim.tasks.pop_front();
+        claimed();
+        return tk;
+      }
+    }
+    return nullptr;
+  }
+
+  auto claimed() -> void {
+    std::lock_guard<std::mutex> lock { sleep_mtx_ };
+    --queued_;
+  }
+
+  auto work(std::size_t ix) -> void {
+    current_pool() = this;
+    current_index() = ix;
+    for (;;) {
+      if (auto tk = take(ix)) {
+        (*tk)();
+        continue;
+      }
+      std::unique_lock<std::mutex> lock { sleep_mtx_ };
+      wake_.wait(lock, [this]() { return stop_ || queued_ > 0; });
+      if (stop_ && queued_ == 0) {
+        return;
+      }
+    }
+  }
+
+  std::vector<queue> queues_;
+  std::vector<std::thread> workers_;
+  std::atomic<std::size_t> next_ { 0 };
+  std::mutex sleep_mtx_;
+  std::condition_variable wake_;
+  std::size_t queued_ = 0;
+  bool stop_ = false;
+};
+
+/*
+ *  MARK: task_group
+ *  A batch of tasks on a thread_pool.  wait() runs queued tasks on the calling
+ *  thread until the whole batch has finished, then rethrows the first
+ *  exception any of them raised.
+ */
+class task_group {
+public:
+  explicit task_group(thread_pool & pool) : pool_ { pool } {}
+
+  task_group(task_group const &) = delete;
+  task_group & operator=(task_group const &) = delete;
+
+  ~task_group() {
+    try { wait(); } catch (...) {}
+  }
+
+  template<typename Fn>
+  auto run(Fn fn) -> void {
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    pool_.push([this, fn = std::move(fn)]() mutable {
+      try {
+        fn();
+      }
+      catch (...) {
+        std::lock_guard<std::mutex> lock { error_mtx_ };
+        if (!error_) {
+          error_ = std::current_exception();
+        }
+      }
+      pending_.fetch_sub(1, std::memory_order_acq_rel);
+    });
+  }
+
+  auto wait() -> void {
+    while (pending_.load(std::memory_order_acquire) != 0) {
+      if (!pool_.try_run_one()) {
+        std::this_thread::yield();
+      }
+    }
+    if (error_) {
+      std::rethrow_exception(std::exchange(error_, nullptr));
+    }
+  }
+
+private:
+  thread_pool & pool_;
+  std::atomic<std::size_t> pending_ { 0 };
+  std::mutex error_mtx_;
+  std::exception_ptr error_;
+};
+
+} /* namespace clst */
+
+#endif /* thread_pool_hpp */
@@ -0,0 +1,266 @@
+//
+//  tracking.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: https://en.cppreference.com/w/cpp/named_req/Allocator
+//  @see: https://en.cppreference.com/w/cpp/language/rule_of_three
+//
+
+#ifndef tracking_hpp
+#define tracking_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <deque>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <compare>
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst
+namespace clst {
+
+/*
+ *  MARK: tracking_counters
+ *  What happened inside one named section: heap traffic through
+ *  tracking_allocator and object lifetime events of tracked<T>.
+ */
+struct tracking_counters {
+  std::string name;
+  std::size_t allocations = 0;
+  std::size_t deallocations = 0;
+  std::size_t bytes = 0;            // total bytes allocated
+  std::int64_t live_bytes = 0;      // allocated by the section and not yet freed
+  std::int64_t peak_bytes = 0;      // high-water mark of live_bytes
+  std::size_t constructions = 0;
+  std::size_t copies = 0;           // copy constructions and copy assignments
+  std::size_t moves = 0;            // move constructions and move assignments
+  std::size_t destructions = 0;
+};
+
+/*
+ *  MARK: tracking
+ *  Registry of sections.  Events are charged to the calling thread's current
+ *  section (set by tracking_scope), or to "(unscoped)" outside any scope;
+ *  a free is charged to the section that made the allocation, wherever it
+ *  happens.  Counters are plain integers: one section must not be fed from
+ *  two threads.
+ */
+class tracking {
+public:
+  static auto section(std::string_view name) -> tracking_counters & {
+    std::lock_guard<std::mutex> lock { registry_mutex() };
+    for (auto & sec : registry()) {
+      if (sec.name == name) {
+        return sec;
+      }
+    }
+    registry().push_back(tracking_counters { std::string(name), });
+    return registry().back();
+  }
+
+  static auto current() -> tracking_counters & {
+    if (auto * cur = current_ptr()) {
+      return *cur;
+    }
+    static auto & unscoped = section("(unscoped)");
+    return unscoped;
+  }
+
+  static auto on_allocate(void const * ptr, std::size_t bytes) -> void {
+    auto & cur = current();
+    {
+      std::lock_guard<std::mutex> lock { owners_mutex() };
+      owners()[ptr] = &cur;
+    }
+    ++cur.allocations;
+    cur.bytes += bytes;
+    cur.live_bytes += static_cast<std::int64_t>(bytes);
+    cur.peak_bytes = std::max(cur.peak_bytes, cur.live_bytes);
+  }
+
+  static auto on_deallocate(void const * ptr, std::size_t bytes) noexcept -> void {
+    auto * owner = &current();
+    {
+      std::lock_guard<std::mutex> lock { owners_mutex() };
+      if (auto it = owners().find(ptr); it != owners().end()) {
+        owner = it->second;
+        owners().erase(it);
+      }
+    }
+    ++owner->deallocations;
+    owner->live_bytes -= static_cast<std::int64_t>(bytes);
+  }
+
+  //  One row per section, in the order the sections were first entered.
+  static auto report(std::ostream & os) -> void {
+    std::lock_guard<std::mutex> lock { registry_mutex() };
+    auto const flags = os.flags();
+    os << std::left << std::setw(28) << "section" << std::right
+       << std::setw(8) << "allocs" << std::setw(8) << "frees" << std::setw(10) << "bytes"
+       << std::setw(10) << "peak" << std::setw(8) << "ctors" << std::setw(8) << "copies"
+       << std::setw(8) << "moves" << std::setw(8) << "dtors" << '\n';
+    for (auto const & sec : registry()) {
+      os << std::left << std::setw(28) << sec.name << std::right
+         << std::setw(8) << sec.allocations << std::setw(8) << sec.deallocations
+         << std::setw(10) << sec.bytes << std::setw(10) << sec.peak_bytes
+         << std::setw(8) << sec.constructions << std::setw(8) << sec.copies
+         << std::setw(8) << sec.moves << std::setw(8) << sec.destructions << '\n';
+    }
+    os.flags(flags);
+  }
+
+private:
+  friend class tracking_scope;
+
+  static auto registry() -> std::deque<tracking_counters> & {
+    static std::deque<tracking_counters> sections;
+    return sections;
+  }
+
+  static auto registry_mutex() -> std::mutex & {
+    static std::mutex mtx;
+    return mtx;
+  }
+
+  //  The section each live allocation was charged to.
+  static auto owners() -> std::unordered_map<void const *, tracking_counters *> & {
+    static std::unordered_map<void const *, tracking_counters *> table;
+    return table;
+  }
+
+  static auto owners_mutex() -> std::mutex & {
+    static std::mutex mtx;
+    return mtx;
+  }
+
+  static auto current_ptr() -> tracking_counters *& {
+    thread_local tracking_counters * cur = nullptr;
+    return cur;
+  }
+};
+
+/*
+ *  MARK: tracking_scope
+ *  Charges events on this thread to the named section until destroyed.
+ *  Scopes nest; re-entering a name adds to the existing row, live bytes
+ *  included.
+ */
+class tracking_scope {
+public:
+  explicit tracking_scope(std::string_view name)
+    : prev_ { tracking::current_ptr() } {
+    tracking::current_ptr() = &tracking::section(name);
+  }
+
+  tracking_scope(tracking_scope const &) = delete;
+  tracking_scope & operator=(tracking_scope const &) = delete;
+
+  ~tracking_scope() { tracking::current_ptr() = prev_; }
+
+private:
+  tracking_counters * prev_;
+};
+
+/*
+ *  MARK: tracking_allocator
+ *  std::allocator that reports every allocation to the current section, and
+ *  every free to the section that allocated it.
+ */
+template<typename T>
+class tracking_allocator {
+public:
+  using value_type = T;
+  using is_always_equal = std::true_type;
+
+  tracking_allocator() noexcept = default;
+  template<typename U>
+  tracking_allocator(tracking_allocator<U> const &) noexcept {}
+
+  auto allocate(std::size_t n) -> T * {
+    auto * ptr = std::allocator<T>().allocate(n);
+    try {
+      tracking::on_allocate(ptr, n * sizeof(T));
+    }
+    catch (...) {
+      std::allocator<T>().deallocate(ptr, n);
+      throw;
+    }
+    return ptr;
+  }
+
+  auto deallocate(T * ptr, std::size_t n) noexcept -> void {
+    tracking::on_deallocate(ptr, n * sizeof(T));
+    std::allocator<T>().deallocate(ptr, n);
+  }
+
+  template<typename U>
+  friend auto operator==(tracking_allocator const &, tracking_allocator<U> const &) noexcept -> bool {
+    return true;
+  }
+};
+
+/*
+ *  MARK: tracked
+ *  Value wrapper that counts its constructions, copies, moves and destructions
+ *  in the current section instead of printing them.
+ */
+template<typename T>
+class tracked {
+  template<typename... Args>
+  static constexpr bool is_self = sizeof...(Args) == 1
+      && (std::is_same_v<std::remove_cvref_t<Args>, tracked> && ...);
+
+public:
+  using value_type = T;
+
+  template<typename... Args>
+    requires (!is_self<Args...> && std::is_constructible_v<T, Args...>)
+  tracked(Args &&... args) : value_ (std::forward<Args>(args)...) {
+    ++tracking::current().constructions;
+  }
+
+  tracked(tracked const & other) : value_ { other.value_ } { ++tracking::current().copies; }
+  tracked(tracked && other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    : value_ { std::move(other.value_) } { ++tracking::current().moves; }
+
+  auto operator=(tracked const & other) -> tracked & {
+    value_ = other.value_;
+    ++tracking::current().copies;
+    return *this;
+  }
+
+  auto operator=(tracked && other) noexcept(std::is_nothrow_move_assignable_v<T>) -> tracked & {
+    value_ = std::move(other.value_);
+    ++tracking::current().moves;
+    return *this;
+  }
+
+  ~tracked() { ++tracking::current().destructions; }
+
+  auto get() noexcept -> T & { return value_; }
+  auto get() const noexcept -> T const & { return value_; }
+  operator T const & () const noexcept { return value_; }
+
+  friend auto operator==(tracked const & lhs, tracked const & rhs) -> bool { return lhs.value_ == rhs.value_; }
+  friend auto operator<=>(tracked const & lhs, tracked const & rhs) { return lhs.value_ <=> rhs.value_; }
+
+  friend auto operator<<(std::ostream & os, tracked const & trk) -> std::ostream & { return os << trk.value_; }
+
+private:
+  T value_;
+};
+
+} /* namespace clst */
+
+#endif /* tracking_hpp */
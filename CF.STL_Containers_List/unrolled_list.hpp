@@ -0,0 +1,862 @@
+//
+//  unrolled_list.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: https://en.wikipedia.org/wiki/Unrolled_linked_list
+//  @see: https://en.cppreference.com/w/cpp/container/list
+//
+
+#ifndef unrolled_list_hpp
+#define unrolled_list_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <memory>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <span>
+#include <compare>
+
+#include "synth_three_way.hpp"
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst
+namespace clst {
+
+/*
+ *  MARK: unrolled_list
+ *  Doubly linked list of chunks, each holding up to 'capacity' elements, with
+ *  the std::list interface.  A chunk is sized to fit in ChunkBytes (one cache
+ *  line by default) so a traversal touches one line per several elements.
+ *
+ *  Differences from std::list:
+ *  - insert/erase shift elements within a chunk, so they invalidate iterators
+ *    into that chunk (and its neighbour when an insert splits or an erase
+ *    merges chunks).  References to other elements stay valid.
+ *  - splice relinks whole chunks, splitting at most three chunks at the ends;
+ *    iterators into the spliced range stay valid unless they point into a
+ *    split chunk.
+ *  - sort, merge, unique and remove move elements between slots instead of
+ *    relinking nodes, so iterators denote positions afterwards, not elements.
+ */
+template<typename T, std::size_t ChunkBytes = 64, typename Allocator = std::allocator<T>>
+class unrolled_list {
+  struct node_base {
+    node_base * prev = nullptr;
+    node_base * next = nullptr;
+  };
+
+  static constexpr std::size_t header_bytes = sizeof(node_base) + sizeof(std::uint32_t);
+
+public:
+  static constexpr std::size_t capacity =
+      ChunkBytes > header_bytes + sizeof(T) ? (ChunkBytes - header_bytes) / sizeof(T) : 1;
+
+private:
+  struct node : node_base {
+    std::uint32_t count = 0;
+    alignas(T) std::byte storage[capacity * sizeof(T)];
+
+    auto data() noexcept -> T * { return std::launder(reinterpret_cast<T *>(storage)); }
+    auto data() const noexcept -> T const * { return std::launder(reinterpret_cast<T const *>(storage)); }
+  };
+
+  using node_alloc = typename std::allocator_traits<Allocator>::template rebind_alloc<node>;
+  using node_traits = std::allocator_traits<node_alloc>;
+
+  static auto as_node(node_base * nb) noexcept -> node * { return static_cast<node *>(nb); }
+
+  template<bool Const>
+  class basic_iterator {
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, T const *, T *>;
+    using reference = std::conditional_t<Const, T const &, T &>;
+
+    basic_iterator() = default;
+    template<bool C = Const, typename = std::enable_if_t<C>>
+    basic_iterator(basic_iterator<false> const & other) noexcept : nd_ { other.nd_ }, ix_ { other.ix_ } {}
+
+    auto operator*() const -> reference { return as_node(nd_)->data()[ix_]; }
+    auto operator->() const -> pointer { return as_node(nd_)->data() + ix_; }
+
+    auto operator++() -> basic_iterator & {
+      if (++ix_ == as_node(nd_)->count) {
+        nd_ = nd_->next;
+        ix_ = 0;
+      }
+      return *this;
+    }
+    auto operator++(int) -> basic_iterator { auto tmp = *this; ++*this; return tmp; }
+
+    auto operator--() -> basic_iterator & {
+      if (ix_ == 0) {
+        nd_ = nd_->prev;
+        ix_ = as_node(nd_)->count - 1;
+      }
+      else {
+        --ix_;
+      }
+      return *this;
+    }
+    auto operator--(int) -> basic_iterator { auto tmp = *this; --*this; return tmp; }
+
+    friend auto operator==(basic_iterator const & lhs, basic_iterator const & rhs) -> bool {
+      return lhs.nd_ == rhs.nd_ && lhs.ix_ == rhs.ix_;
+    }
+
+  private:
+    friend class unrolled_list;
+    friend class basic_iterator<!Const>;
+
+    basic_iterator(node_base const * nd, std::size_t ix) noexcept
+      : nd_ { const_cast<node_base *>(nd) }, ix_ { ix } {}
+
+    node_base * nd_ = nullptr;
+    std::size_t ix_ = 0;
+  };
+
+public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T &;
+  using const_reference = T const &;
+  using pointer = typename std::allocator_traits<Allocator>::pointer;
+  using const_pointer = typename std::allocator_traits<Allocator>::const_pointer;
+  using iterator = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  //  MARK: construct/copy/destroy
+  unrolled_list() : unrolled_list(Allocator()) {}
+  explicit unrolled_list(Allocator const & alloc) : alloc_ { alloc } { reset(); }
+
+  explicit unrolled_list(size_type count, Allocator const & alloc = Allocator())
+    : unrolled_list(alloc) { resize(count); }
+
+  unrolled_list(size_type count, T const & value, Allocator const & alloc = Allocator())
+    : unrolled_list(alloc) { append(count, value); }
+
+  template<typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  unrolled_list(InputIt first, InputIt last, Allocator const & alloc = Allocator())
+    : unrolled_list(alloc) { append(first, last); }
+
+  unrolled_list(std::initializer_list<T> init, Allocator const & alloc = Allocator())
+    : unrolled_list(init.begin(), init.end(), alloc) {}
+
+  unrolled_list(unrolled_list const & other)
+    : unrolled_list(other.begin(), other.end(),
+                    std::allocator_traits<Allocator>::select_on_container_copy_construction(other.get_allocator())) {}
+
+  unrolled_list(unrolled_list && other) noexcept : alloc_ { std::move(other.alloc_) } {
+    reset();
+    steal(other);
+  }
+
+  ~unrolled_list() { clear(); }
+
+  auto operator=(unrolled_list const & other) -> unrolled_list & {
+    if (this != &other) {
+      assign(other.begin(), other.end());
+    }
+    return *this;
+  }
+
+  auto operator=(unrolled_list && other) noexcept(node_traits::propagate_on_container_move_assignment::value
+                                                  || node_traits::is_always_equal::value) -> unrolled_list & {
+    if (this == &other) {
+      return *this;
+    }
+    if constexpr (node_traits::propagate_on_container_move_assignment::value) {
+      clear();
+      alloc_ = std::move(other.alloc_);
+      steal(other);
+    }
+    else {
+      if (alloc_ == other.alloc_) {
+        clear();
+        steal(other);
+      }
+      else {
+        assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+        other.clear();
+      }
+    }
+    return *this;
+  }
+
+  auto operator=(std::initializer_list<T> init) -> unrolled_list & {
+    assign(init.begin(), init.end());
+    return *this;
+  }
+
+  auto assign(size_type count, T const & value) -> void {
+    clear();
+    append(count, value);
+  }
+
+  template<typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  auto assign(InputIt first, InputIt last) -> void {
+    clear();
+    append(first, last);
+  }
+
+  auto assign(std::initializer_list<T> init) -> void { assign(init.begin(), init.end()); }
+
+  auto get_allocator() const -> allocator_type { return allocator_type(alloc_); }
+
+  //  MARK: element access
+  auto front() -> reference { return *begin(); }
+  auto front() const -> const_reference { return *begin(); }
+  auto back() -> reference { return *std::prev(end()); }
+  auto back() const -> const_reference { return *std::prev(end()); }
+
+  //  MARK: iterators
+  auto begin() noexcept -> iterator { return iterator(head_.next, 0); }
+  auto begin() const noexcept -> const_iterator { return const_iterator(head_.next, 0); }
+  auto cbegin() const noexcept -> const_iterator { return begin(); }
+  auto end() noexcept -> iterator { return iterator(&head_, 0); }
+  auto end() const noexcept -> const_iterator { return const_iterator(&head_, 0); }
+  auto cend() const noexcept -> const_iterator { return end(); }
+  auto rbegin() noexcept -> reverse_iterator { return reverse_iterator(end()); }
+  auto rbegin() const noexcept -> const_reverse_iterator { return const_reverse_iterator(end()); }
+  auto crbegin() const noexcept -> const_reverse_iterator { return rbegin(); }
+  auto rend() noexcept -> reverse_iterator { return reverse_iterator(begin()); }
+  auto rend() const noexcept -> const_reverse_iterator { return const_reverse_iterator(begin()); }
+  auto crend() const noexcept -> const_reverse_iterator { return rend(); }
+
+  //  MARK: capacity
+  [[nodiscard]] auto empty() const noexcept -> bool { return size_ == 0; }
+  auto size() const noexcept -> size_type { return size_; }
+  auto max_size() const noexcept -> size_type { return node_traits::max_size(alloc_) * capacity; }
+
+  //  Number of chunks currently linked; size() / chunks() is the fill factor.
+  auto chunks() const noexcept -> size_type { return chunks_; }
+
+  //  Forward cursor over the chunks, each seen as one contiguous span of
+  //  elements, for algorithms that work on whole blocks (see simd_compare.hpp).
+  class chunk_cursor {
+  public:
+    auto done() const noexcept -> bool { return nb_ == head_; }
+    auto span() const noexcept -> std::span<T const> {
+      auto const * nd = static_cast<node const *>(nb_);
+      return { nd->data(), nd->count, };
+    }
+    auto next() noexcept -> void { nb_ = nb_->next; }
+
+  private:
+    friend class unrolled_list;
+    chunk_cursor(node_base const * head) noexcept : nb_ { head->next }, head_ { head } {}
+
+    node_base const * nb_;
+    node_base const * head_;
+  };
+
+  auto chunk_begin() const noexcept -> chunk_cursor { return chunk_cursor(&head_); }
+
+  //  MARK: modifiers
+  auto clear() noexcept -> void {
+    auto * nb = head_.next;
+    while (nb != &head_) {
+      auto * nx = nb->next;
+      free_node(as_node(nb));
+      nb = nx;
+    }
+    reset();
+  }
+
+  auto insert(const_iterator pos, T const & value) -> iterator { return emplace(pos, value); }
+  auto insert(const_iterator pos, T && value) -> iterator { return emplace(pos, std::move(value)); }
+
+  auto insert(const_iterator pos, size_type count, T const & value) -> iterator {
+    unrolled_list tmp(get_allocator());
+    tmp.append(count, value);
+    return splice_in(pos, tmp);
+  }
+
+  template<typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  auto insert(const_iterator pos, InputIt first, InputIt last) -> iterator {
+    unrolled_list tmp(get_allocator());
+    tmp.append(first, last);
+    return splice_in(pos, tmp);
+  }
+
+  auto insert(const_iterator pos, std::initializer_list<T> init) -> iterator {
+    return insert(pos, init.begin(), init.end());
+  }
+
+  template<typename... Args>
+  auto emplace(const_iterator pos, Args &&... args) -> iterator {
+    if (pos.nd_ == &head_) {
+      emplace_back(std::forward<Args>(args)...);
+      return std::prev(end());
+    }
+
+    auto * nd = as_node(pos.nd_);
+    auto ix = pos.ix_;
+    // Inserting before the first element of a chunk: append to the previous
+    // chunk when it has room rather than shifting this one.
+    if (ix == 0 && nd->prev != &head_ && as_node(nd->prev)->count < capacity) {
+      auto * pv = as_node(nd->prev);
+      std::construct_at(pv->data() + pv->count, std::forward<Args>(args)...);
+      ++pv->count;
+      ++size_;
+      return iterator(pv, pv->count - 1);
+    }
+
+    T tmp(std::forward<Args>(args)...);
+    if (nd->count == capacity) {
+      auto * sp = split_node(nd, capacity / 2);
+      if (ix > nd->count) {
+        ix -= nd->count;
+        nd = sp;
+      }
+    }
+    shift_in(nd, ix, std::move(tmp));
+    ++size_;
+    return iterator(nd, ix);
+  }
+
+  auto erase(const_iterator pos) -> iterator {
+    auto * nd = as_node(pos.nd_);
+    auto const ix = pos.ix_;
+    auto * data = nd->data();
+    std::move(data + ix + 1, data + nd->count, data + ix);
+    std::destroy_at(data + nd->count - 1);
+    --nd->count;
+    --size_;
+
+    if (nd->count == 0) {
+      auto * nx = nd->next;
+      unlink(nd);
+      free_node(nd);
+      return iterator(nx, 0);
+    }
+
+    // Fold an underfull chunk's successor into it so chunks stay dense.
+    if (nd->count < capacity / 2 && nd->next != &head_) {
+      auto * nx = as_node(nd->next);
+      if (nd->count + nx->count <= capacity) {
+        std::uninitialized_move(nx->data(), nx->data() + nx->count, data + nd->count);
+        nd->count += nx->count;
+        std::destroy(nx->data(), nx->data() + nx->count);
+        nx->count = 0;
+        unlink(nx);
+        free_node(nx);
+      }
+    }
+    return ix < nd->count ? iterator(nd, ix) : iterator(nd->next, 0);
+  }
+
+  auto erase(const_iterator first, const_iterator last) -> iterator {
+    if (first == last) {
+      return iterator(last.nd_, last.ix_);
+    }
+
+    if (first.nd_ == last.nd_) {
+      auto * nd = as_node(first.nd_);
+      auto * data = nd->data();
+      auto const gap = last.ix_ - first.ix_;
+      std::move(data + last.ix_, data + nd->count, data + first.ix_);
+      std::destroy(data + nd->count - gap, data + nd->count);
+      nd->count -= static_cast<std::uint32_t>(gap);
+      size_ -= gap;
+      return iterator(nd, first.ix_);
+    }
+
+    // Tail of the first chunk.
+    auto * nb = first.nd_;
+    {
+      auto * nd = as_node(nb);
+      std::destroy(nd->data() + first.ix_, nd->data() + nd->count);
+      size_ -= nd->count - first.ix_;
+      nd->count = static_cast<std::uint32_t>(first.ix_);
+      nb = nb->next;
+      if (nd->count == 0) {
+        unlink(nd);
+        free_node(nd);
+      }
+    }
+    // Whole chunks in between.
+    while (nb != last.nd_) {
+      auto * nx = nb->next;
+      size_ -= as_node(nb)->count;
+      unlink(as_node(nb));
+      free_node(as_node(nb));
+      nb = nx;
+    }
+    // Head of the last chunk.
+    if (last.ix_ > 0) {
+      auto * nd = as_node(last.nd_);
+      auto * data = nd->data();
+      std::move(data + last.ix_, data + nd->count, data);
+      std::destroy(data + nd->count - last.ix_, data + nd->count);
+      nd->count -= static_cast<std::uint32_t>(last.ix_);
+      size_ -= last.ix_;
+    }
+    return iterator(last.nd_, 0);
+  }
+
+  auto push_back(T const & value) -> void { emplace_back(value); }
+  auto push_back(T && value) -> void { emplace_back(std::move(value)); }
+
+  template<typename... Args>
+  auto emplace_back(Args &&... args) -> reference {
+    auto * nd = head_.prev != &head_ ? as_node(head_.prev) : nullptr;
+    if (nd == nullptr || nd->count == capacity) {
+      auto * fresh = make_node();
+      try {
+        std::construct_at(fresh->data(), std::forward<Args>(args)...);
+      }
+      catch (...) {
+        free_node(fresh);
+        throw;
+      }
+      link_before(&head_, fresh);
+      nd = fresh;
+    }
+    else {
+      std::construct_at(nd->data() + nd->count, std::forward<Args>(args)...);
+    }
+    ++nd->count;
+    ++size_;
+    return nd->data()[nd->count - 1];
+  }
+
+  auto pop_back() -> void { erase(std::prev(end())); }
+
+  auto push_front(T const & value) -> void { emplace_front(value); }
+  auto push_front(T && value) -> void { emplace_front(std::move(value)); }
+
+  template<typename... Args>
+  auto emplace_front(Args &&... args) -> reference {
+    auto * nd = head_.next != &head_ ? as_node(head_.next) : nullptr;
+    if (nd == nullptr || nd->count == capacity) {
+      auto * fresh = make_node();
+      try {
+        std::construct_at(fresh->data(), std::forward<Args>(args)...);
+      }
+      catch (...) {
+        free_node(fresh);
+        throw;
+      }
+      fresh->count = 1;
+      link_before(head_.next, fresh);
+      ++size_;
+      return fresh->data()[0];
+    }
+    shift_in(nd, 0, T(std::forward<Args>(args)...));
+    ++size_;
+    return nd->data()[0];
+  }
+
+  auto pop_front() -> void { erase(begin()); }
+
+  auto resize(size_type count) -> void {
+    if (count < size_) {
+      erase(std::next(begin(), static_cast<difference_type>(count)), end());
+    }
+    while (size_ < count) {
+      emplace_back();
+    }
+  }
+
+  auto resize(size_type count, T const & value) -> void {
+    if (count < size_) {
+      erase(std::next(begin(), static_cast<difference_type>(count)), end());
+    }
+    append(count - size_, value);
+  }
+
+  auto swap(unrolled_list & other) noexcept -> void {
+    if constexpr (node_traits::propagate_on_container_swap::value) {
+      using std::swap;
+      swap(alloc_, other.alloc_);
+    }
+    unrolled_list tmp(alloc_);
+    tmp.steal(other);
+    other.steal(*this);
+    steal(tmp);
+  }
+
+  //  MARK: operations
+  auto merge(unrolled_list & other) -> void { merge(std::move(other), std::less<>()); }
+  auto merge(unrolled_list && other) -> void { merge(std::move(other), std::less<>()); }
+  template<typename Compare>
+  auto merge(unrolled_list & other, Compare comp) -> void { merge(std::move(other), comp); }
+
+  //  Stable merge of two sorted lists.  Elements are moved into freshly packed
+  //  chunks; each source chunk is released as soon as it has been consumed.
+  //  If comp or a move throws, the merged prefix goes to the front of *this
+  //  and the unconsumed elements stay where they were: no element is lost.
+  template<typename Compare>
+  auto merge(unrolled_list && other, Compare comp) -> void {
+    if (this == &other || other.empty()) {
+      return;
+    }
+    unrolled_list out(get_allocator());
+    chunk_drain lhs(*this), rhs(other);
+    try {
+      while (!lhs.done() && !rhs.done()) {
+        auto & src = comp(rhs.peek(), lhs.peek()) ? rhs : lhs;
+        out.emplace_back(std::move(src.peek()));
+        src.pop();
+      }
+      for (auto * src : { &lhs, &rhs, }) {
+        while (!src->done()) {
+          out.emplace_back(std::move(src->peek()));
+          src->pop();
+        }
+      }
+    }
+    catch (...) {
+      lhs.settle();
+      rhs.settle();
+      splice_in(cbegin(), out);
+      throw;
+    }
+    steal(out);
+  }
+
+  auto splice(const_iterator pos, unrolled_list & other) -> void { splice(pos, std::move(other)); }
+  auto splice(const_iterator pos, unrolled_list && other) -> void {
+    if (this != &other && !other.empty()) {
+      splice_in(pos, other);
+    }
+  }
+
+  auto splice(const_iterator pos, unrolled_list & other, const_iterator it) -> void {
+    if (&other == this && (pos == it || pos == std::next(it))) {
+      return;
+    }
+    splice(pos, other, it, std::next(it));
+  }
+  auto splice(const_iterator pos, unrolled_list && other, const_iterator it) -> void {
+    splice(pos, other, it);
+  }
+
+  auto splice(const_iterator pos, unrolled_list && other, const_iterator first, const_iterator last) -> void {
+    splice(pos, other, first, last);
+  }
+
+  //  Split the chunks at 'last', 'first' and 'pos' so the range is a run of
+  //  whole chunks, then relink that run.  O(chunks in range) for the size.
+  auto splice(const_iterator pos, unrolled_list & other, const_iterator first, const_iterator last) -> void {
+    if (first == last || (&other == this && (pos == first || pos == last))) {
+      return;
+    }
+    auto * tail = other.split_at(last, { &pos, });
+    auto * head = other.split_at(first, { &pos, });
+    auto * at = split_at(pos, {});
+
+    size_type moved = 0;
+    size_type nodes = 0;
+    for (auto * nb = head; nb != tail; nb = nb->next) {
+      moved += as_node(nb)->count;
+      ++nodes;
+    }
+    auto * back = tail->prev;
+    head->prev->next = tail;
+    tail->prev = head->prev;
+    other.size_ -= moved;
+    other.chunks_ -= nodes;
+
+    head->prev = at->prev;
+    back->next = at;
+    at->prev->next = head;
+    at->prev = back;
+    size_ += moved;
+    chunks_ += nodes;
+  }
+
+  auto remove(T const & value) -> size_type {
+    T const val = value;  // 'value' may refer to an element that gets overwritten.
+    return remove_if([&val](T const & el) { return el == val; });
+  }
+
+  //  One pass: survivors are moved forward over the holes and the emptied
+  //  tail chunks are released.
+  template<typename UnaryPredicate>
+  auto remove_if(UnaryPredicate pred) -> size_type {
+    auto wr = begin();
+    for (auto rd = begin(); rd != end(); ++rd) {
+      if (!pred(*rd)) {
+        if (wr != rd) {
+          *wr = std::move(*rd);
+        }
+        ++wr;
+      }
+    }
+    auto const before = size_;
+    erase(wr, end());
+    return before - size_;
+  }
+
+  auto reverse() noexcept -> void {
+    auto * nb = &head_;
+    do {
+      std::swap(nb->prev, nb->next);
+      if (nb != &head_) {
+        auto * nd = as_node(nb);
+        std::reverse(nd->data(), nd->data() + nd->count);
+      }
+      nb = nb->prev;
+    } while (nb != &head_);
+  }
+
+  auto unique() -> size_type { return unique(std::equal_to<>()); }
+
+  template<typename BinaryPredicate>
+  auto unique(BinaryPredicate pred) -> size_type {
+    if (size_ < 2) {
+      return 0;
+    }
+    auto kept = begin();
+    auto wr = std::next(kept);
+    for (auto rd = wr; rd != end(); ++rd) {
+      if (!pred(*kept, *rd)) {
+        if (wr != rd) {
+          *wr = std::move(*rd);
+        }
+        kept = wr;
+        ++wr;
+      }
+    }
+    auto const before = size_;
+    erase(wr, end());
+    return before - size_;
+  }
+
+  auto sort() -> void { sort(std::less<>()); }
+
+  //  Elements are stable-sorted in a contiguous buffer and moved back into the
+  //  same slots.  Trivially copyable elements are copied out, so the slots
+  //  still hold them if comp throws; other types sort pointers to the slots
+  //  and only move elements once the order is known.  Either way a throwing
+  //  comp leaves every element in the list.
+  template<typename Compare>
+  auto sort(Compare comp) -> void {
+    if (size_ < 2) {
+      return;
+    }
+    std::vector<T> buf;
+    buf.reserve(size_);
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      std::copy(begin(), end(), std::back_inserter(buf));
+      std::stable_sort(buf.begin(), buf.end(), comp);
+    }
+    else {
+      std::vector<T *> order;
+      order.reserve(size_);
+      for (auto & el : *this) {
+        order.push_back(std::addressof(el));
+      }
+      std::stable_sort(order.begin(), order.end(), [&comp](T const * lhs, T const * rhs) { return comp(*lhs, *rhs); });
+      for (auto * el : order) {
+        buf.push_back(std::move(*el));
+      }
+    }
+    std::move(buf.begin(), buf.end(), begin());
+  }
+
+private:
+  //  Sequential consumer used by merge: yields elements front to back and
+  //  frees each chunk once it has been read.
+  //  A consumed chunk is unlinked before it is freed, so the list always holds
+  //  exactly the chunks not yet drained.
+  class chunk_drain {
+  public:
+    explicit chunk_drain(unrolled_list & lst) : lst_ { lst }, nb_ { lst.head_.next } {}
+    auto done() const -> bool { return nb_ == &lst_.head_; }
+    auto peek() -> T & { return as_node(nb_)->data()[ix_]; }
+    auto pop() -> void {
+      if (++ix_ == as_node(nb_)->count) {
+        auto * nd = as_node(nb_);
+        nb_ = nb_->next;
+        ix_ = 0;
+        lst_.size_ -= nd->count;
+        lst_.unlink(nd);
+        lst_.free_node(nd);
+      }
+    }
+
+    //  Drop the moved-from elements at the front of the current chunk.
+    auto settle() -> void {
+      if (ix_ != 0) {
+        lst_.erase(lst_.cbegin(), const_iterator(nb_, ix_));
+        ix_ = 0;
+      }
+    }
+
+  private:
+    unrolled_list & lst_;
+    node_base * nb_;
+    std::size_t ix_ = 0;
+  };
+
+  auto reset() noexcept -> void {
+    head_.prev = head_.next = &head_;
+    size_ = 0;
+    chunks_ = 0;
+  }
+
+  //  Take over other's chunks; *this must be empty.
+  auto steal(unrolled_list & other) noexcept -> void {
+    if (other.empty()) {
+      return;
+    }
+    head_.next = other.head_.next;
+    head_.prev = other.head_.prev;
+    head_.next->prev = &head_;
+    head_.prev->next = &head_;
+    size_ = other.size_;
+    chunks_ = other.chunks_;
+    other.reset();
+  }
+
+  auto make_node() -> node * {
+    auto * nd = node_traits::allocate(alloc_, 1);
+    return ::new (static_cast<void *>(nd)) node;
+  }
+
+  auto free_node(node * nd) noexcept -> void {
+    std::destroy(nd->data(), nd->data() + nd->count);
+    nd->~node();
+    node_traits::deallocate(alloc_, nd, 1);
+  }
+
+  auto link_before(node_base * at, node * nd) noexcept -> void {
+    nd->next = at;
+    nd->prev = at->prev;
+    at->prev->next = nd;
+    at->prev = nd;
+    ++chunks_;
+  }
+
+  auto unlink(node * nd) noexcept -> void {
+    nd->prev->next = nd->next;
+    nd->next->prev = nd->prev;
+    --chunks_;
+  }
+
+  //  Open a hole at ix in a chunk that has room and move value into it.
+  auto shift_in(node * nd, std::size_t ix, T && value) -> void {
+    auto * data = nd->data();
+    if (ix == nd->count) {
+      std::construct_at(data + ix, std::move(value));
+    }
+    else {
+      std::construct_at(data + nd->count, std::move(data[nd->count - 1]));
+      std::move_backward(data + ix, data + nd->count - 1, data + nd->count);
+      data[ix] = std::move(value);
+    }
+    ++nd->count;
+  }
+
+  //  Move elements [at, count) of nd into a new chunk linked after it.
+  auto split_node(node * nd, std::size_t at) -> node * {
+    auto * fresh = make_node();
+    std::uninitialized_move(nd->data() + at, nd->data() + nd->count, fresh->data());
+    fresh->count = nd->count - static_cast<std::uint32_t>(at);
+    std::destroy(nd->data() + at, nd->data() + nd->count);
+    nd->count = static_cast<std::uint32_t>(at);
+    link_before(nd->next, fresh);
+    return fresh;
+  }
+
+  //  Make 'pos' the first element of its chunk and return that chunk (or the
+  //  sentinel for end()).  Iterators listed in 'fixups' that pointed at or
+  //  past pos in the same chunk are re-seated into the new chunk.
+  auto split_at(const_iterator pos, std::initializer_list<const_iterator *> fixups) -> node_base * {
+    if (pos.ix_ == 0) {
+      return pos.nd_;
+    }
+    auto * fresh = split_node(as_node(pos.nd_), pos.ix_);
+    for (auto * fx : fixups) {
+      if (fx->nd_ == pos.nd_ && fx->ix_ >= pos.ix_) {
+        *fx = const_iterator(fresh, fx->ix_ - pos.ix_);
+      }
+    }
+    return fresh;
+  }
+
+  //  Move all of other's chunks in before pos; returns the first of them.
+  auto splice_in(const_iterator pos, unrolled_list & other) -> iterator {
+    if (other.empty()) {
+      return iterator(pos.nd_, pos.ix_);
+    }
+    auto * at = split_at(pos, {});
+    auto * first = other.head_.next;
+    auto * last = other.head_.prev;
+    first->prev = at->prev;
+    last->next = at;
+    at->prev->next = first;
+    at->prev = last;
+    size_ += other.size_;
+    chunks_ += other.chunks_;
+    other.reset();
+    return iterator(first, 0);
+  }
+
+  auto append(size_type count, T const & value) -> void {
+    for (size_type ix = 0; ix < count; ++ix) {
+      emplace_back(value);
+    }
+  }
+
+  template<typename InputIt>
+  auto append(InputIt first, InputIt last) -> void {
+    for (; first != last; ++first) {
+      emplace_back(*first);
+    }
+  }
+
+  node_base head_;
+  size_type size_ = 0;
+  size_type chunks_ = 0;
+  [[no_unique_address]] node_alloc alloc_;
+};
+
+//  MARK: non-member functions
+template<typename T, std::size_t B, typename A>
+auto operator==(unrolled_list<T, B, A> const & lhs, unrolled_list<T, B, A> const & rhs) -> bool {
+  return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template<typename T, std::size_t B, typename A>
+auto operator<=>(unrolled_list<T, B, A> const & lhs, unrolled_list<T, B, A> const & rhs) {
+  return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                                                detail::synth_three_way {});
+}
+
+template<typename T, std::size_t B, typename A>
+auto swap(unrolled_list<T, B, A> & lhs, unrolled_list<T, B, A> & rhs) noexcept -> void {
+  lhs.swap(rhs);
+}
+
+template<typename T, std::size_t B, typename A, typename U>
+auto erase(unrolled_list<T, B, A> & container, U const & value) -> typename unrolled_list<T, B, A>::size_type {
+  return container.remove_if([&value](auto const & el) { return el == value; });
+}
+
+template<typename T, std::size_t B, typename A, typename Pred>
+auto erase_if(unrolled_list<T, B, A> & container, Pred pred) -> typename unrolled_list<T, B, A>::size_type {
+  return container.remove_if(pred);
+}
+
+} /* namespace clst */
+
+#endif /* unrolled_list_hpp */
@@ -0,0 +1,523 @@
+//
+//  workload.hpp
+//  CF.STL_Containers_List
+//
+//  MARK: - Reference.
+//  @see: https://en.cppreference.com/w/cpp/numeric/random/discrete_distribution
+//  @see: https://en.cppreference.com/w/cpp/chrono/steady_clock
+//
+
+#ifndef workload_hpp
+#define workload_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <memory>
+#include <ostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "node_pool.hpp"
+#include "unrolled_list.hpp"
+#include "compact_list.hpp"
+#include "thread_pool.hpp"
+#include "stopwatch.hpp"
+#include "instrumented_list.hpp"
+
+//  MARK: - Definitions
+//  ================================================================================
+//  MARK: namespace clst
+namespace clst {
+
+/*
+ *  MARK: workload_op
+ *  The operations a workload mixes.  insert and erase act at a cursor that
+ *  wanders a few elements forward before each of them; find looks for a
+ *  random value; iterate walks the whole container.
+ */
+enum class workload_op : std::size_t {
+  push_back, push_front, pop_back, pop_front, insert, erase, find, iterate, sort, count_,
+};
+
+inline constexpr std::array<std::string_view, static_cast<std::size_t>(workload_op::count_)> workload_op_names {
+  "push_back", "push_front", "pop_back", "pop_front", "insert", "erase", "find", "iterate", "sort",
+};
+
+/*
+ *  MARK: workload_spec
+ *  What to replay, read from 'key = value' lines (# starts a comment) or
+ *  from key=value arguments:
+ *
+ *    container = std::list      std::list, clst::pooled_list, clst::compact_list,
+ *                               clst::unrolled_list, std::vector, std::deque
+ *    type      = int            int, char, std::string
+ *    size      = 10000          elements loaded before the replay starts
+ *    ops       = 1000000        operations replayed, shared between the threads
+ *    threads   = 1              each thread replays on a container of its own
+ *    seed      = 42
+ *    mix       = push_back:30, pop_front:30, insert:15, erase:15, find:5, iterate:5
+ *
+ *  Bad keys and values throw std::invalid_argument.
+ */
+struct workload_spec {
+  std::string container = "std::list";
+  std::string type = "int";
+  std::size_t size = 10'000;
+  std::size_t ops = 1'000'000;
+  std::size_t threads = 1;
+  std::uint32_t seed = 42;
+  std::array<unsigned, static_cast<std::size_t>(workload_op::count_)> mix { 30, 0, 0, 30, 15, 15, 5, 5, 0, };
+
+  auto set(std::string_view key, std::string_view value) -> void {
+    key = trim(key);
+    key.remove_prefix(std::min(key.find_first_not_of('-'), key.size()));
+    value = trim(value);
+    if (key == "container") {
+      container = std::string(value);
+    }
+    else if (key == "type") {
+      type = std::string(value);
+    }
+    else if (key == "size") {
+      size = number(key, value);
+    }
+    else if (key == "ops") {
+      ops = number(key, value);
+    }
+    else if (key == "threads") {
+      threads = number(key, value);
+      if (threads == 0) {
+        throw std::invalid_argument("workload: threads must be at least 1");
+      }
+    }
+    else if (key == "seed") {
+      seed = static_cast<std::uint32_t>(number(key, value));
+    }
+    else if (key == "mix") {
+      set_mix(value);
+    }
+    else {
+      throw std::invalid_argument("workload: unknown key '" + std::string(key) + "'");
+    }
+  }
+
+  //  key=value; anything else is taken as the name of a spec file.
+  auto apply(std::string_view arg) -> void {
+    if (auto const eq = arg.find('='); eq != std::string_view::npos) {
+      set(arg.substr(0, eq), arg.substr(eq + 1));
+      return;
+    }
+    std::ifstream file { std::string(arg) };
+    if (!file) {
+      throw std::invalid_argument("workload: cannot open '" + std::string(arg) + "'");
+    }
+    read(file);
+  }
+
+  auto read(std::istream & is) -> void {
+    for (std::string line; std::getline(is, line);) {
+      std::string_view text { line };
+      text = trim(text.substr(0, text.find('#')));
+      if (text.empty()) {
+        continue;
+      }
+      auto const eq = text.find('=');
+      if (eq == std::string_view::npos) {
+        throw std::invalid_argument("workload: expected 'key = value', got '" + std::string(text) + "'");
+      }
+      set(text.substr(0, eq), text.substr(eq + 1));
+    }
+  }
+
+  auto weight(workload_op op) const -> unsigned { return mix[static_cast<std::size_t>(op)]; }
+
+private:
+  static auto trim(std::string_view str) -> std::string_view {
+    auto const first = str.find_first_not_of(" \t\r\n");
+    if (first == std::string_view::npos) {
+      return {};
+    }
+    return str.substr(first, str.find_last_not_of(" \t\r\n") - first + 1);
+  }
+
+  static auto number(std::string_view key, std::string_view value) -> std::size_t {
+    try {
+      std::size_t used = 0;
+      auto const num = std::stod(std::string(value), &used);
+      //  Negative, NaN and anything past the range of size_t fail here,
+      //  before the conversion.
+      if (used == value.size() && num >= 0 && num < std::ldexp(1.0, std::numeric_limits<std::size_t>::digits)) {
+        return static_cast<std::size_t>(num);
+      }
+    }
+    catch (std::exception const &) {
+    }
+    throw std::invalid_argument("workload: " + std::string(key) + " needs a number, got '" + std::string(value) + "'");
+  }
+
+  //  op:weight pairs separated by commas; ops left out get weight 0.
+  auto set_mix(std::string_view value) -> void {
+    mix.fill(0);
+    while (!value.empty()) {
+      auto const comma = value.find(',');
+      auto const item = trim(value.substr(0, comma));
+      value = comma == std::string_view::npos ? std::string_view {} : value.substr(comma + 1);
+      if (item.empty()) {
+        continue;
+      }
+      auto const colon = item.find(':');
+      auto const name = trim(item.substr(0, colon));
+      auto const found = std::find(workload_op_names.begin(), workload_op_names.end(), name);
+      if (colon == std::string_view::npos || found == workload_op_names.end()) {
+        throw std::invalid_argument("workload: bad mix entry '" + std::string(item) + "'");
+      }
+      mix[static_cast<std::size_t>(found - workload_op_names.begin())]
+          = static_cast<unsigned>(number(name, item.substr(colon + 1)));
+    }
+    if (std::all_of(mix.begin(), mix.end(), [](unsigned wt) { return wt == 0; })) {
+      throw std::invalid_argument("workload: the mix has no operations");
+    }
+  }
+};
+
+/*
+ *  MARK: workload_result
+ */
+struct workload_result {
+  std::array<latency_histogram, static_cast<std::size_t>(workload_op::count_)> ops {};
+  std::size_t final_size = 0;
+  double seconds = 0.0;
+
+  auto total() const -> std::uint64_t {
+    std::uint64_t sum = 0;
+    for (auto const & hist : ops) {
+      sum += hist.count();
+    }
+    return sum;
+  }
+};
+
+namespace detail {
+
+template<typename C>
+inline constexpr bool stable_cursor = false;
+template<typename T, typename A>
+inline constexpr bool stable_cursor<std::list<T, A>> = true;
+template<typename T, typename I>
+inline constexpr bool stable_cursor<compact_list<T, I>> = true;
+
+/*
+ *  MARK: workload_runner
+ *  Replays ops operations of a mix on one container C of T.  Containers
+ *  whose iterators survive insertion elsewhere (the lists) keep the cursor
+ *  as an iterator.  For the others the position is kept as well: insert and
+ *  erase hand back a valid cursor, and after an operation that may have
+ *  moved the elements it is found again from the position, only when the
+ *  next insert or erase needs it.  Moving the cursor is not timed: an
+ *  operation's latency is the container's work alone.
+ */
+template<typename C>
+class workload_runner {
+  using T = typename C::value_type;
+
+public:
+  workload_runner(workload_spec const & spec, std::uint32_t seed)
+    : rng_ { seed }, pick_ { spec.mix.begin(), spec.mix.end() }, range_ { spec.size * 2 + 1 } {
+    for (std::size_t ix = 0; ix < spec.size; ++ix) {
+      lst_.push_back(make_value());
+    }
+    cursor_ = lst_.begin();
+  }
+
+  auto run(std::size_t ops, workload_result & res) -> void {
+    for (std::size_t ix = 0; ix < ops; ++ix) {
+      auto const op = static_cast<workload_op>(pick_(rng_));
+      auto value = make_value();
+      auto const steps = static_cast<std::size_t>(rng_() % 4);
+      if (op == workload_op::insert || op == workload_op::erase) {
+        wander(steps);
+      }
+      stopwatch sw;
+      apply(op, std::move(value));
+      res.ops[static_cast<std::size_t>(op)].record(
+          static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(sw.elapsed()).count()));
+    }
+    res.final_size = lst_.size();
+  }
+
+  auto sink() const noexcept -> std::size_t { return sink_; }
+
+private:
+  auto make_value() -> T {
+    auto const num = rng_() % range_;
+    if constexpr (std::is_same_v<T, std::string>) {
+      return "key-" + std::to_string(num);
+    }
+    else {
+      return static_cast<T>(num);
+    }
+  }
+
+  static auto weigh(T const & val) noexcept -> std::size_t {
+    if constexpr (std::is_same_v<T, std::string>) {
+      return val.size();
+    }
+    else {
+      return static_cast<std::size_t>(val);
+    }
+  }
+
+  auto make_list() -> C {
+    if constexpr (std::is_same_v<C, pooled_list<T>>) {
+      return C(pool_allocator<T>(pool_));
+    }
+    else {
+      return C();
+    }
+  }
+
+  auto apply(workload_op op, T && value) -> void {
+    switch (op) {
+    case workload_op::push_back:
+      lst_.push_back(std::move(value));
+      stale_ = true;
+      break;
+    case workload_op::push_front:
+      if constexpr (requires { lst_.push_front(std::move(value)); }) {
+        lst_.push_front(std::move(value));
+      }
+      else {
+        lst_.insert(lst_.begin(), std::move(value));
+      }
+      ++pos_;
+      stale_ = true;
+      break;
+    case workload_op::pop_back:
+      if (!lst_.empty()) {
+        if constexpr (stable_cursor<C>) {
+          if (cursor_ != lst_.end() && std::next(cursor_) == lst_.end()) {
+            cursor_ = lst_.end();
+          }
+        }
+        lst_.pop_back();
+        stale_ = true;
+      }
+      break;
+    case workload_op::pop_front:
+      if (!lst_.empty()) {
+        if constexpr (stable_cursor<C>) {
+          if (cursor_ == lst_.begin()) {
+            ++cursor_;
+          }
+        }
+        if constexpr (requires { lst_.pop_front(); }) {
+          lst_.pop_front();
+        }
+        else {
+          lst_.erase(lst_.begin());
+        }
+        pos_ -= pos_ != 0 ? 1 : 0;
+        stale_ = true;
+      }
+      break;
+    case workload_op::insert:
+      cursor_ = lst_.insert(cursor_, std::move(value));
+      break;
+    case workload_op::erase:
+      if (cursor_ == lst_.end()) {
+        cursor_ = lst_.begin();
+        pos_ = 0;
+      }
+      if (cursor_ != lst_.end()) {
+        cursor_ = lst_.erase(cursor_);
+      }
+      break;
+    case workload_op::find:
+      sink_ += static_cast<std::size_t>(std::distance(lst_.begin(), std::find(lst_.begin(), lst_.end(), value)));
+      break;
+    case workload_op::iterate:
+      for (auto const & el : lst_) {
+        sink_ += weigh(el);
+      }
+      break;
+    case workload_op::sort:
+      if constexpr (requires { lst_.sort(); }) {
+        lst_.sort();
+      }
+      else {
+        std::sort(lst_.begin(), lst_.end());
+      }
+      stale_ = true;
+      break;
+    case workload_op::count_:
+      break;
+    }
+  }
+
+  //  Moves the cursor steps elements forward, back to the front past the end.
+  auto wander(std::size_t steps) -> void {
+    if constexpr (!stable_cursor<C>) {
+      if (stale_) {
+        pos_ = std::min(pos_, lst_.size());
+        cursor_ = std::next(lst_.begin(), static_cast<std::ptrdiff_t>(pos_));
+        stale_ = false;
+      }
+    }
+    for (; steps != 0; --steps) {
+      if (cursor_ == lst_.end()) {
+        cursor_ = lst_.begin();
+        pos_ = 0;
+      }
+      else {
+        ++cursor_;
+        ++pos_;
+      }
+    }
+  }
+
+  node_pool<T> pool_;
+  C lst_ = make_list();
+  typename C::iterator cursor_ {};
+  std::size_t pos_ = 0;
+  bool stale_ = false;  // cursor_ must be found again from pos_
+  std::size_t sink_ = 0;
+  std::mt19937 rng_;
+  std::discrete_distribution<std::size_t> pick_;
+  std::uint64_t range_;
+};
+
+//  The containers are loaded and the threads started before the clock starts:
+//  seconds covers the replay alone.
+template<typename C>
+auto replay_on(workload_spec const & spec) -> workload_result {
+  std::vector<workload_result> parts(spec.threads);
+  std::vector<std::unique_ptr<workload_runner<C>>> runners(spec.threads);
+  std::vector<std::size_t> sinks(spec.threads);
+  auto load = [&](std::size_t ix) {
+    runners[ix] = std::make_unique<workload_runner<C>>(spec, static_cast<std::uint32_t>(spec.seed + ix));
+  };
+  auto job = [&](std::size_t ix) {
+    runners[ix]->run(spec.ops / spec.threads + (ix < spec.ops % spec.threads ? 1 : 0), parts[ix]);
+    sinks[ix] = runners[ix]->sink();
+  };
+
+  workload_result res;
+  if (spec.threads == 1) {
+    load(0);
+    stopwatch sw;
+    job(0);
+    res.seconds = std::chrono::duration<double>(sw.elapsed()).count();
+  }
+  else {
+    thread_pool pool { spec.threads };
+    {
+      task_group group { pool };
+      for (std::size_t ix = 0; ix < spec.threads; ++ix) {
+        group.run([&load, ix]() { load(ix); });
+      }
+      group.wait();
+    }
+    task_group group { pool };
+    stopwatch sw;
+    for (std::size_t ix = 0; ix < spec.threads; ++ix) {
+      group.run([&job, ix]() { job(ix); });
+    }
+    group.wait();
+    res.seconds = std::chrono::duration<double>(sw.elapsed()).count();
+  }
+  for (auto const & part : parts) {
+    for (std::size_t op = 0; op < res.ops.size(); ++op) {
+      res.ops[op].merge(part.ops[op]);
+    }
+    res.final_size += part.final_size;
+  }
+  return res;
+}
+
+template<typename T>
+auto replay_as(workload_spec const & spec) -> workload_result {
+  std::string_view name { spec.container };
+  for (std::string_view prefix : { "std::", "clst::", }) {
+    if (name.starts_with(prefix)) {
+      name.remove_prefix(prefix.size());
+    }
+  }
+  if (name == "list")          { return replay_on<std::list<T>>(spec); }
+  if (name == "pooled_list")   { return replay_on<pooled_list<T>>(spec); }
+  if (name == "compact_list")  { return replay_on<compact_list<T>>(spec); }
+  if (name == "unrolled_list") { return replay_on<unrolled_list<T>>(spec); }
+  if (name == "vector")        { return replay_on<std::vector<T>>(spec); }
+  if (name == "deque")         { return replay_on<std::deque<T>>(spec); }
+  throw std::invalid_argument("workload: unknown container '" + spec.container + "'");
+}
+
+} /* namespace detail */
+
+/*
+ *  MARK: replay()
+ *  Runs the workload at full speed and reports the throughput and, per
+ *  operation, the latency percentiles in nanoseconds.  Every operation is
+ *  timed on its own, so ops/s includes two clock reads per operation, and
+ *  the moves of the cursor; loading the containers is left out.
+ */
+inline auto replay(workload_spec const & spec, std::ostream & os) -> workload_result {
+  std::string_view type { spec.type };
+  if (type.starts_with("std::")) {
+    type.remove_prefix(5);
+  }
+  workload_result res;
+  if (type == "int") {
+    res = detail::replay_as<int>(spec);
+  }
+  else if (type == "char") {
+    res = detail::replay_as<char>(spec);
+  }
+  else if (type == "string") {
+    res = detail::replay_as<std::string>(spec);
+  }
+  else {
+    throw std::invalid_argument("workload: unknown type '" + spec.type + "'");
+  }
+
+  auto const flags = os.flags();
+  auto const precision = os.precision();
+  auto const total = res.total();
+  os << "container: " << spec.container << ", type: " << spec.type << ", size: " << spec.size
+     << ", threads: " << spec.threads << ", seed: " << spec.seed << '\n';
+  os << std::fixed << std::setprecision(3) << total << " ops in " << res.seconds << " s: "
+     << std::setprecision(0) << (res.seconds > 0.0 ? static_cast<double>(total) / res.seconds : 0.0)
+     << " ops/s, final size " << res.final_size << '\n';
+  os << std::left << std::setw(12) << "op" << std::right << std::setw(10) << "count"
+     << std::setw(10) << "p50" << std::setw(10) << "p99" << std::setw(10) << "p999" << std::setw(12) << "max" << '\n';
+  for (std::size_t ix = 0; ix < res.ops.size(); ++ix) {
+    auto const & hist = res.ops[ix];
+    if (hist.count() == 0) {
+      continue;
+    }
+    os << std::left << std::setw(12) << workload_op_names[ix] << std::right << std::setw(10) << hist.count()
+       << std::setw(10) << hist.percentile(0.50) << std::setw(10) << hist.percentile(0.99)
+       << std::setw(10) << hist.percentile(0.999) << std::setw(12) << hist.max() << '\n';
+  }
+  os.flags(flags);
+  os.precision(precision);
+  return res;
+}
+
+} /* namespace clst */
+
+#endif /* workload_hpp */